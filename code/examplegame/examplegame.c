@@ -39,13 +39,19 @@ const MinigameDef minigame_def = {
     .gamename = "Example Game",
     .developername = "Your Name",
     .description = "This is an example game.",
-    .instructions = "Mash A to win."
+    .instructions = "Mash A to win.",
+    .tickrate = 30,
+    .resolution = RESOLUTION_320x240,
+    .depth = DEPTH_16_BPP,
+    .buffers = 3,
+    .filters = FILTERS_RESAMPLE,
 };
 
 rdpq_font_t *font;
 
 uint32_t player_points[MAXPLAYERS];
 uint32_t ai_press_timer[MAXPLAYERS];
+CoreRng *ai_rng;
 
 float countdown_timer;
 bool is_ending;
@@ -76,7 +82,7 @@ uint32_t ai_get_ticks_until_next_press()
     const float min_ticks[] = { 2.8f, 2.4f, 2.0f };   // Minimum delay in ticks by difficulty
     const float max_ticks[] = { 8.4f, 7.7f, 7.0f };   // Maximum delay in ticks by difficulty
 
-    float random = (float)rand() / RAND_MAX;
+    float random = core_rng_float(ai_rng);
 
     int diff = core_get_aidifficulty();
     return min_ticks[diff] + random * (max_ticks[diff] - min_ticks[diff]);
@@ -89,7 +95,7 @@ uint32_t ai_get_ticks_until_next_press()
 
 void minigame_init()
 {
-    display_init(RESOLUTION_320x240, DEPTH_16_BPP, 3, GAMMA_NONE, FILTERS_RESAMPLE);
+    ai_rng = core_rng_get("examplegame.ai");
     font = rdpq_font_load_builtin(FONT_BUILTIN_DEBUG_VAR);
     rdpq_text_register_font(FONT_TEXT, font);
 
@@ -107,6 +113,24 @@ void minigame_init()
 }
 
 
+/*==============================
+    minigame_warmup
+    Optional. Called over and over after minigame_init,
+    while the core shows a loading screen, until it
+    returns true. Use it to spread slow setup, like
+    loading models or recording blocks, across frames.
+    Keep each step short.
+    @param  The step number, counting from 0
+    @return Whether warming up is finished
+==============================*/
+
+bool minigame_warmup(int step)
+{
+    // Nothing slow to set up here
+    return true;
+}
+
+
 /*==============================
     minigame_fixedloop
     Code that is called every loop, at a fixed delta time.
@@ -247,7 +271,6 @@ void minigame_cleanup()
     wav64_close(&sfx_countdown);
     wav64_close(&sfx_stop);
     wav64_close(&sfx_winner);
-    display_close();
     rdpq_text_unregister_font(FONT_TEXT);
     rdpq_font_free(font);
 }
\ No newline at end of file
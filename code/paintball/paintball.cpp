@@ -12,7 +12,11 @@ extern "C" const MinigameDef minigame_def = {
     .gamename = "Paintball",
     .developername = "Ali Naci Erdem",
     .description = "Paint enemies to capture & score for your team. Winning color or last one standing gets more points!",
-    .instructions = "Move with analog stick, press C/D pad to shoot. Press START to pause."
+    .instructions = "Move with analog stick, press C/D pad to shoot. Press START to pause.",
+    .resolution = RESOLUTION_320x240,
+    .depth = DEPTH_16_BPP,
+    .buffers = DisplayBufferCount,
+    .filters = FILTERS_RESAMPLE,
 };
 
 /*==============================
@@ -24,6 +28,18 @@ extern "C" void minigame_init()
     game = new Game();
 }
 
+/*==============================
+    minigame_warmup
+    Builds the game's renderers behind the core's loading
+    screen, a piece per step
+    @param  The step number
+    @return Whether warming up is finished
+==============================*/
+extern "C" bool minigame_warmup(int step)
+{
+    return game->warmup(step);
+}
+
 /*==============================
     minigame_fixedloop
     Code that is called every loop, at a fixed delta time.
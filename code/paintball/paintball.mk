@@ -11,12 +11,33 @@ ASSETS_LIST += \
 	filesystem/paintball/marker.ia4.sprite \
 	filesystem/paintball/shadow.t3dm \
 	filesystem/paintball/shadow.i8.sprite \
-	filesystem/paintball/FingerPaint-Regular.font64 \
-	filesystem/paintball/FingerPaint-Regular-Medium.font64 \
-	filesystem/paintball/FingerPaint-Regular-Big.font64 \
+	filesystem/paintball/FingerPaint.fontpack \
 	filesystem/paintball/fire.wav64 \
 	filesystem/paintball/hit.wav64
 
-filesystem/paintball/FingerPaint-Regular.font64: MKFONT_FLAGS += --outline 1 --size 12
-filesystem/paintball/FingerPaint-Regular-Medium.font64: MKFONT_FLAGS += --outline 2 --size 24
-filesystem/paintball/FingerPaint-Regular-Big.font64: MKFONT_FLAGS += --outline 2 --size 36
\ No newline at end of file
+# All three sizes are built from the same TTF and shipped as one font pack, in
+# the order of SmallFont, MediumFont and BigFont. mkfont names its output after
+# the input file, so every size goes through its own directory. The sizes are
+# left uncompressed, the pack is compressed as a whole.
+PAINTBALL_FONT_SIZES = Small Medium Big
+PAINTBALL_FONT_DIR = $(BUILD_DIR)/paintball/fonts
+
+$(PAINTBALL_FONT_DIR)/Small.font64: PAINTBALL_FONT_FLAGS = --outline 1 --size 12
+$(PAINTBALL_FONT_DIR)/Medium.font64: PAINTBALL_FONT_FLAGS = --outline 2 --size 24
+$(PAINTBALL_FONT_DIR)/Big.font64: PAINTBALL_FONT_FLAGS = --outline 2 --size 36
+
+$(PAINTBALL_FONT_DIR)/%.font64: assets/paintball/FingerPaint-Regular.ttf
+	@mkdir -p $(PAINTBALL_FONT_DIR)/$*
+	@echo "    [FONT] $@"
+	$(N64_MKFONT) $(MKFONT_FLAGS) $(PAINTBALL_FONT_FLAGS) -c 0 -o $(PAINTBALL_FONT_DIR)/$* "$<"
+	mv $(PAINTBALL_FONT_DIR)/$*/FingerPaint-Regular.font64 $@
+
+tools/mkfontpack/mkfontpack: tools/mkfontpack/mkfontpack.c fontpack.h
+	@echo "    [HOST] $@"
+	$(MAKE) -C tools/mkfontpack mkfontpack
+
+filesystem/paintball/FingerPaint.fontpack: $(PAINTBALL_FONT_SIZES:%=$(PAINTBALL_FONT_DIR)/%.font64) tools/mkfontpack/mkfontpack
+	@mkdir -p $(dir $@)
+	@echo "    [FONTPACK] $@"
+	tools/mkfontpack/mkfontpack -o $@ $(PAINTBALL_FONT_SIZES:%=$(PAINTBALL_FONT_DIR)/%.font64)
+	$(N64_BINDIR)/mkasset -c 2 -o $(dir $@) $@
@@ -1,26 +1,23 @@
 #include "ai.hpp"
 
-AI::AI() : aiActionTimer(0) {
+AI::AI(const AIParams &params) : aiActionTimer(0), params(params), rng(core_rng_get("paintball.ai")) {
     difficulty = core_get_aidifficulty();
 }
 
 Direction AI::calculateFireDirection(Player& player, float deltaTime, std::vector<Player> &players, GameState &state) {
     aiActionTimer += deltaTime;
 
-    float actionRate = AIActionRateSecond;
+    float actionRate = params.actionRateSecond * params.actionRateMultiplier[difficulty];
     float tempControl = 1.f;
     if (difficulty == AiDiff::DIFF_EASY) {
         if (player.aiState != AIState::AI_ATTACK) {
             return Direction::NONE;
         }
-        actionRate = AIActionRateSecond * 2.f;
     } else if (difficulty == AiDiff::DIFF_MEDIUM) {
         if (player.aiState == AIState::AI_RUN) {
             return Direction::NONE;
         }
-        actionRate = AIActionRateSecond * 1.5f;
     } else if (difficulty == AiDiff::DIFF_HARD) {
-        actionRate = AIActionRateSecond;
         // Hard can barely overheat
         tempControl = (player.aiState == AIState::AI_ATTACK) ? CooldownPerSecond : 0.4f;
     }
@@ -47,7 +44,7 @@ Direction AI::calculateFireDirection(Player& player, float deltaTime, std::vecto
         T3DVec3 diff = {0};
         t3d_vec3_diff(diff, player.pos, other.pos);
 
-        float random = static_cast<float>(rand()) / RAND_MAX;
+        float random = core_rng_float(rng);
         float missFactorSeconds = 0.f;
         bool shouldMiss = false;
         if (difficulty == AiDiff::DIFF_EASY) {
@@ -117,27 +114,22 @@ Direction AI::calculateFireDirection(Player& player, float deltaTime, std::vecto
 }
 
 void AI::tryChangeState(Player& player, AIState newState) {
-    float random = static_cast<float>(rand()) / RAND_MAX;
+    float random = core_rng_float(rng);
 
-    float unstability = AIUnstable;
-    if (difficulty == AiDiff::DIFF_EASY) {
-        // More difficult to change state to converge on the "better" strat
-        unstability *= 0.5f;
-    } else if (difficulty == AiDiff::DIFF_MEDIUM) {
-        unstability *= 0.7f;
-    }
+    // Lower difficulties find it harder to change state to converge on the "better" strat
+    float unstability = params.unstable * params.unstableMultiplier[difficulty];
 
     if (random > unstability) {
         return;
     }
 
     player.aiState = newState;
-    player.multiplier = 1.f + AIRandomRange * (static_cast<float>(rand()) / RAND_MAX);
-    player.multiplier2 = 1.f + AIRandomRange * (static_cast<float>(rand()) / RAND_MAX);
+    player.multiplier = 1.f + AIRandomRange * (core_rng_float(rng));
+    player.multiplier2 = 1.f + AIRandomRange * (core_rng_float(rng));
 }
 
-void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player> &players, GameState &state, T3DVec3 &inputDirection) {
-    float random = static_cast<float>(rand()) / RAND_MAX;
+void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player> &players, GameState &state, const InfluenceMap &influence, T3DVec3 &inputDirection) {
+    float random = core_rng_float(rng);
 
     // Defaults
     float escapeWeight = 100.f;
@@ -151,6 +143,11 @@ void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player>
 
     float alignment = 0.1f;
 
+    // Influence map
+    float dangerWeight = 0.5f;
+    float territoryWeight = 0.f;
+    float boundaryWeight = 80.f;
+
     if (difficulty == AiDiff::DIFF_EASY) {
         escapeWeight = 1.f;
         alignment *= 0.f;
@@ -159,8 +156,8 @@ void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player>
         alignment *= 0.5f;
     }
 
-    if (random < AITemperature) {
-        int r = randomRange(1, 3);
+    if (random < params.temperature) {
+        int r = core_rng_range(rng, 1, 3);
         player.aiState = (AIState)r;
     }
 
@@ -187,6 +184,9 @@ void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player>
         playerRepulsion = 0.3f * player.multiplier2;
 
         alignment *= player.multiplier;
+
+        // Push into enemy paint
+        territoryWeight = -5.f;
     } else if (player.aiState == AIState::AI_DEFEND) {
         centerAttraction = 0.4f;
 
@@ -194,6 +194,9 @@ void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player>
         playerRepulsion = 0.5f * player.multiplier;
 
         alignment *= -player.multiplier;
+
+        // Fall back to own paint
+        territoryWeight = 20.f;
     } else if (player.aiState == AIState::AI_RUN) {
         centerAttraction = 0.2f;
         randomWeight = 1.f;
@@ -202,6 +205,7 @@ void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player>
         playerRepulsion = 0.001f * player.multiplier;
 
         alignment = 0.f;
+        territoryWeight = 10.f;
     }
 
     // Bullet escape
@@ -239,6 +243,18 @@ void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player>
     }
     player.incomingBullets.clear();
 
+    // Local neighbourhood from the influence map, constant cost per AI
+    InfluenceSample local = influence.sample(player.pos, player.team);
+
+    t3d_vec3_scale(local.danger, local.danger, escapeWeight * dangerWeight);
+    t3d_vec3_add(inputDirection, inputDirection, local.danger);
+
+    t3d_vec3_scale(local.territory, local.territory, territoryWeight);
+    t3d_vec3_add(inputDirection, inputDirection, local.territory);
+
+    t3d_vec3_scale(local.boundary, local.boundary, boundaryWeight);
+    t3d_vec3_add(inputDirection, inputDirection, local.boundary);
+
     // center attraction
     T3DVec3 diff = {0};
     t3d_vec3_diff(diff, T3DVec3 {0}, player.pos);
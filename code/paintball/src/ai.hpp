@@ -3,26 +3,52 @@
 
 #include <t3d/t3dmath.h>
 
+#include <array>
+
 #include "../../../core.h"
 #include "common.hpp"
 #include "player.hpp"
 #include "gamestate.hpp"
+#include "influence.hpp"
 
 constexpr float AITemperature = 0.06f;
 constexpr float AIUnstable = 0.02f;
 constexpr float AIActionRateSecond = 0.2;
 
+// Tunables, exposed so they can be swept by the host tournament runner
+struct AIParams {
+    float temperature;
+    float unstable;
+    float actionRateSecond;
+    // Indexed by AiDiff
+    float actionRateMultiplier[3];
+    float unstableMultiplier[3];
+};
+
+constexpr AIParams DefaultAIParams {
+    .temperature = AITemperature,
+    .unstable = AIUnstable,
+    .actionRateSecond = AIActionRateSecond,
+    .actionRateMultiplier = {2.f, 1.5f, 1.f},
+    .unstableMultiplier = {0.5f, 0.7f, 1.f},
+};
+
+using AIParamSet = std::array<AIParams, PlayerCount>;
+constexpr AIParamSet DefaultAIParamSet {DefaultAIParams, DefaultAIParams, DefaultAIParams, DefaultAIParams};
+
 class AI
 {
     private:
         float aiActionTimer;
         AiDiff difficulty;
+        AIParams params;
+        CoreRng *rng;
 
         void tryChangeState(Player& player, AIState newState);
     public:
-        AI();
+        AI(const AIParams &params);
         Direction calculateFireDirection(Player&, float deltaTime, std::vector<Player> &players, GameState &state);
-        void calculateMovement(Player&, float deltaTime, std::vector<Player> &players, GameState &state, T3DVec3 &inputDirection);
+        void calculateMovement(Player&, float deltaTime, std::vector<Player> &players, GameState &state, const InfluenceMap &influence, T3DVec3 &inputDirection);
 };
 
 #endif // __AI_H
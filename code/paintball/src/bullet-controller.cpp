@@ -7,6 +7,7 @@ BulletController::BulletController(std::shared_ptr<MapRenderer> map, std::shared
         t3d_model_free
     }),
     block({nullptr, rspq_block_free}),
+    matrices({core_framering_new(DisplayBufferCount, sizeof(T3DMat4FP), BulletLimit), core_framering_free}),
     map(map),
     ui(ui),
     sfxFire("rom:/paintball/fire.wav64"),
@@ -48,24 +49,26 @@ void BulletController::render(float deltaTime) {
 
     double interpolate = core_get_subtick();
 
+    int slot = 0;
     for (auto bullet = bullets.begin(); bullet != bullets.end(); ++bullet) {
-        assertf(bullet->matFP.get(), "Bullet matrix is null");
         assertf(block.get(), "Bullet dl is null");
 
+        T3DMat4FP *mat = (T3DMat4FP*)core_framering_get(matrices.get(), slot++);
+
         T3DVec3 currentPos {0};
         t3d_vec3_lerp(currentPos, bullet->prevPos, bullet->pos, interpolate);
 
         t3d_mat4fp_from_srt_euler(
-            bullet->matFP.get(),
+            mat,
             T3DVec3 {0.2f, 0.2f, 0.2f},
             // TODO: add some random rotation
             T3DVec3 {0.0f, 0.0f, 0.0f},
             T3DVec3 {currentPos.v[0], currentPos.v[1], currentPos.v[2]}
         );
 
-        t3d_matrix_push(bullet->matFP.get());
+        t3d_matrix_push(mat);
             rdpq_set_prim_color(colors[bullet->team]);
-            rspq_block_run(block.get());
+            core_trace_block_run(block.get(), "bullet");
         t3d_matrix_pop(1);
     }
 }
@@ -90,16 +93,19 @@ bool BulletController::simulatePhysics(float deltaTime, Bullet &bullet) {
     return false;
 }
 
-void BulletController::fixedUpdate(float deltaTime, std::vector<Player> &gameplayData) {
+void BulletController::fixedUpdate(float deltaTime, std::vector<Player> &gameplayData, InfluenceMap &influence) {
     assertf(map.get(), "Map renderer is null");
     for (auto bullet = bullets.begin(); bullet != bullets.end(); ++bullet) {
         bool isDead = simulatePhysics(deltaTime, *bullet);
         if (isDead) {
             map->splash(bullet->pos.v[0], bullet->pos.v[2], bullet->team, atan2f(bullet->velocity.v[0], bullet->velocity.v[2]));
+            influence.addPaint(bullet->pos.v[0], bullet->pos.v[2], bullet->team);
             bullets.remove(bullet);
             continue;
         }
 
+        influence.addBullet(bullet->pos, bullet->velocity, bullet->team);
+
         int i = 0;
         // TODO: if we could delegate this to player.cpp, b/c collider doesn't belong here
         for (auto& player : gameplayData)
@@ -124,6 +130,7 @@ void BulletController::fixedUpdate(float deltaTime, std::vector<Player> &gamepla
 
                 ui->registerHit(HitMark {bullet->pos, bullet->owner});
                 map->splash(bullet->pos.v[0], bullet->pos.v[2], bullet->team, atan2f(bullet->velocity.v[0], bullet->velocity.v[2]));
+                influence.addPaint(bullet->pos.v[0], bullet->pos.v[2], bullet->team);
                 wav64_play(sfxHit.get(), HitAudioChannel);
                 bullets.remove(bullet);
 
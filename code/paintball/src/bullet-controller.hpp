@@ -21,6 +21,7 @@
 #include "./map.hpp"
 #include "./ui.hpp"
 #include "./bullet.hpp"
+#include "./influence.hpp"
 
 constexpr float BulletHeight = 35.f;
 constexpr int BulletLimit = 100;
@@ -32,6 +33,7 @@ class BulletController
         std::size_t newBulletCount;
         U::T3DModel model;
         U::RSPQBlock block;
+        U::FrameRing matrices;
 
         List<Bullet, BulletLimit> bullets;
 
@@ -47,7 +49,7 @@ class BulletController
     public:
         BulletController(std::shared_ptr<MapRenderer> map, std::shared_ptr<UIRenderer> ui);
         void render(float deltaTime);
-        void fixedUpdate(float deltaTime, std::vector<Player> &);
+        void fixedUpdate(float deltaTime, std::vector<Player> &, InfluenceMap &);
         void fireBullet(const T3DVec3 &pos, const T3DVec3 &velocity, PlyNum owner, PlyNum team);
 };
 
@@ -41,9 +41,6 @@ class Bullet
         T3DVec3 velocity;
         PlyNum team;
         PlyNum owner;
-
-        // This is non-movable, it can only be created with default ctor
-        const U::T3DMat4FP matFP;
 };
 
 #endif // __BULLET_H
\ No newline at end of file
@@ -1,5 +0,0 @@
-#include "common.hpp"
-
-int randomRange(int min, int max){
-   return min + rand() / (RAND_MAX / (max - min + 1) + 1);
-};
\ No newline at end of file
@@ -11,6 +11,4 @@ enum Direction {
     RIGHT
 };
 
-int randomRange(int min, int max);
-
 #endif // __COMMON_H
\ No newline at end of file
@@ -11,6 +11,7 @@ constexpr int BigFont = 3;
 
 constexpr int ScreenWidth = 320;
 constexpr int ScreenHeight = 240;
+constexpr int DisplayBufferCount = 3;
 
 // Gameplay
 constexpr int PlayerCount = MAXPLAYERS;
@@ -25,6 +26,13 @@ constexpr float CooldownPerSecond = 1.f;
 constexpr float TempPerBullet = 0.35f;
 constexpr float OverheatPenalty = 1.5f;
 
+// Animation LOD
+// Below this speed the walk cycle is paused and the last pose is reused
+constexpr float AnimIdleSpeed = SpeedLimit * 0.02f;
+// Players out of view only advance their animation this often
+constexpr float AnimOffscreenInterval = 0.1f;
+constexpr float AnimBoundsHalfExtent = PlayerRadius * 3.f;
+
 // AI
 constexpr float AICloseRange = 100;
 constexpr float AIFarRange = 200;
@@ -1,12 +1,10 @@
 #include "game.hpp"
 
-Game::Game() :
+Game::Game(const AIParamSet &aiParams) :
     viewport(t3d_viewport_create()),
-    font("rom:/paintball/FingerPaint-Regular.font64", SmallFont),
     timer({nullptr, delete_timer}),
-    mapRenderer(std::make_shared<MapRenderer>()),
     uiRenderer(std::make_shared<UIRenderer>()),
-    gameplayController(mapRenderer, uiRenderer),
+    aiParams(aiParams),
     state({
         .state = STATE_COUNTDOWN,
         .timeInState = 0.0f,
@@ -17,22 +15,6 @@ Game::Game() :
     sfxFinish("rom:/core/Winner.wav64"),
     sfxLastOne("rom:/core/Stop.wav64")
 {
-    rdpq_fontstyle_t p1Style = { .color = PLAYERCOLOR_1 };
-    rdpq_fontstyle_t p2Style = { .color = PLAYERCOLOR_2 };
-    rdpq_fontstyle_t p3Style = { .color = PLAYERCOLOR_3 };
-    rdpq_fontstyle_t p4Style = { .color = PLAYERCOLOR_4 };
-    rdpq_fontstyle_t style = { .color = RGBA32(255, 255, 180, 255) };
-
-    auto fnt = font.font.get();
-    assertf(fnt, "Font is null");
-
-    // TODO: move to player.cpp?
-    rdpq_font_style(fnt, 0, &p1Style);
-    rdpq_font_style(fnt, 1, &p2Style);
-    rdpq_font_style(fnt, 2, &p3Style);
-    rdpq_font_style(fnt, 3, &p4Style);
-    rdpq_font_style(fnt, 4, &style);
-
     camTarget = T3DVec3 {{0, 0, 40}};
     camPos = T3DVec3 {{0, 125.0f, 100.0f}};
 
@@ -43,6 +25,20 @@ Game::~Game() {
     debugf("Paintball minigame cleaned up\n");
 }
 
+// The map, the bullets and each player record draw blocks, one of them per step
+bool Game::warmup(int step) {
+    switch (step) {
+        case 0:
+            mapRenderer = std::make_shared<MapRenderer>();
+            return false;
+        case 1:
+            gameplayController = std::make_unique<GameplayController>(mapRenderer, uiRenderer, aiParams);
+            return false;
+        default:
+            return gameplayController->addPlayer();
+    }
+}
+
 void Game::render(float deltaTime) {
     if (state.state == STATE_PAUSED) {
         deltaTime = 0.0f;
@@ -87,10 +83,10 @@ void Game::render(float deltaTime) {
     mapRenderer->render(deltaTime, viewport.viewFrustum);
 
     if (state.state != STATE_PAUSED) {
-        gameplayController.render(deltaTime, viewport, state);
+        gameplayController->render(deltaTime, viewport, state);
 
         // 2D
-        gameplayController.renderUI();
+        gameplayController->renderUI(uiRenderer->getOverlay());
     }
     uiRenderer->render(state, viewport, deltaTime);
 
@@ -109,6 +105,10 @@ void Game::fixedUpdate(float deltaTime) {
 
     state.timeInState += deltaTime;
 
+    if (state.state == STATE_GAME || state.state == STATE_LAST_ONE_STANDING) {
+        state.roundTime += deltaTime;
+    }
+
     if (state.state == STATE_GAME) {
         state.gameTime += deltaTime;
         if (state.gameTime > MapShrinkTime) {
@@ -117,17 +117,39 @@ void Game::fixedUpdate(float deltaTime) {
         mapRenderer->setSize(1.f - (state.gameTime / MapShrinkTime));
     }
 
-    gameplayController.fixedUpdate(deltaTime, state);
+    gameplayController->fixedUpdate(deltaTime, state);
 
     processState();
 }
 
-void Game::addScores(const std::vector<Player> &playerData) {
+const GameState &Game::getState() const {
+    return state;
+}
+
+int Game::addScores(const std::vector<Player> &playerData) {
+    int captures = 0;
     for (int i = 0; i < PlayerCount; i++) {
         for (int j = 0; j < PlayerCount; j++) {
-            state.scores[i] += (playerData[j].capturer == i) ? 1 : 0;
+            int captured = (playerData[j].capturer == i) ? 1 : 0;
+            state.scores[i] += captured;
+            captures += captured;
         }
     }
+    return captures;
+}
+
+void Game::endRound(PlyNum winner, int captures) {
+    state.rounds[state.currentRound] = RoundStats {
+        .length = state.roundTime,
+        .captures = captures,
+        .winner = winner,
+    };
+
+    state.currentRound++;
+    state.winner = winner;
+
+    state.timeInState = 0.0f;
+    state.state = STATE_WAIT_FOR_NEW_ROUND;
 }
 
 void Game::processState() {
@@ -163,20 +185,21 @@ void Game::processState() {
     if (state.state == STATE_COUNTDOWN && state.timeInState > 3.0f) {
         state.timeInState = 0.0f;
         state.gameTime = 0.0f;
+        state.roundTime = 0.0f;
         state.state = STATE_GAME;
         wav64_play(sfxStart.get(), GeneralPurposeAudioChannel);
         return;
     }
 
     if (state.state == STATE_WAIT_FOR_NEW_ROUND && state.timeInState > 5.0f) {
-        gameplayController.newRound();
+        gameplayController->newRound();
         mapRenderer->setSize(1.f);
         state.timeInState = 0.0f;
         state.state = STATE_COUNTDOWN;
         return;
     }
 
-    auto&& playerData = gameplayController.getPlayerData();
+    auto&& playerData = gameplayController->getPlayerData();
     std::array<int, PlayerCount> counts = {0};
 
     int largestTeamCount = 0;
@@ -194,16 +217,11 @@ void Game::processState() {
         (state.state == STATE_GAME || state.state == STATE_LAST_ONE_STANDING) &&
         largestTeamCount == PlayerCount
     ) {
-        state.currentRound++;
-
         // One point to the team owner
         state.scores[largestTeam]++;
-        state.winner = largestTeam;
 
-        addScores(playerData);
-
-        state.timeInState = 0.0f;
-        state.state = STATE_WAIT_FOR_NEW_ROUND;
+        int captures = addScores(playerData);
+        endRound(largestTeam, captures);
         return;
     }
 
@@ -230,15 +248,11 @@ void Game::processState() {
             i++;
         }
 
-        addScores(playerData);
+        int captures = addScores(playerData);
 
-        state.currentRound++;
         // Two points if can escape
         state.scores[lastPlayerTeam] += 2;
-        state.winner = lastPlayerTeam;
-
-        state.timeInState = 0.0f;
-        state.state = STATE_WAIT_FOR_NEW_ROUND;
+        endRound(lastPlayerTeam, captures);
         return;
     }
 }
@@ -19,6 +19,7 @@
 #include "./map.hpp"
 #include "./ui.hpp"
 #include "./gamestate.hpp"
+#include "./text.hpp"
 
 #include <functional>
 #include <memory>
@@ -32,7 +33,7 @@ class Game
         Display display;
         T3D t3d;
         T3DViewport viewport;
-        RDPQFont font;
+        FontFamily fonts;
         U::Timer timer;
 
         // Map
@@ -42,8 +43,9 @@ class Game
         // UI
         std::shared_ptr<UIRenderer> uiRenderer;
 
-        // Controllers
-        GameplayController gameplayController;
+        // Controllers, built by warmup
+        AIParamSet aiParams;
+        std::unique_ptr<GameplayController> gameplayController;
 
         // Camera
         T3DVec3 camTarget;
@@ -57,13 +59,16 @@ class Game
 
         void gameOver();
         void processState();
-        void addScores(const std::vector<Player>&);
+        int addScores(const std::vector<Player>&);
+        void endRound(PlyNum winner, int captures);
 
     public:
-        Game();
+        Game(const AIParamSet &aiParams = DefaultAIParamSet);
         ~Game();
+        bool warmup(int step);
         void render(float deltatime);
         void fixedUpdate(float deltatime);
+        const GameState &getState() const;
 };
 
 #endif /* __GAME_H */
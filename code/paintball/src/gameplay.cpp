@@ -1,6 +1,6 @@
 #include "./gameplay.hpp"
 
-GameplayController::GameplayController(std::shared_ptr<MapRenderer> map, std::shared_ptr<UIRenderer> ui) :
+GameplayController::GameplayController(std::shared_ptr<MapRenderer> map, std::shared_ptr<UIRenderer> ui, const AIParamSet &aiParams) :
     bulletController(map, ui),
     model({
         t3d_model_load("rom:/paintball/char.t3dm"),
@@ -11,19 +11,42 @@ GameplayController::GameplayController(std::shared_ptr<MapRenderer> map, std::sh
         t3d_model_free
     }),
     arrowSprite {sprite_load("rom:/paintball/arrow.ia4.sprite"), sprite_free},
-    map(map)
+    map(map),
+    spawnRng(core_rng_get("paintball.spawn"))
     {
+        pendingFire.fill(NONE);
+        tickInputs.fill(TickInput {{0}, NONE});
+
         assertf(model.get(), "Player model is null");
 
         playerData.reserve(PlayerCount);
-        playerData.emplace_back(Player {{-100,0,0}, PLAYER_1, model.get(), shadowModel.get()});
-        playerData.emplace_back(Player {{0,0,-100}, PLAYER_2, model.get(), shadowModel.get()});
-        playerData.emplace_back(Player {{100,0,0}, PLAYER_3, model.get(), shadowModel.get()});
-        playerData.emplace_back(Player {{0,0,100}, PLAYER_4, model.get(), shadowModel.get()});
 
-        newRound();
+        // One AI per player, so each keeps its own action timer and tunables
+        ai.reserve(PlayerCount);
+        for (auto &params : aiParams) {
+            ai.emplace_back(params);
+        }
     }
 
+// Players record their draw blocks when created, so they're added one at a time
+// and the first round only starts once all of them are in
+bool GameplayController::addPlayer()
+{
+    std::array<T3DVec3, PlayerCount> startPositions {
+        T3DVec3{-100, 0, 0},
+        T3DVec3{0, 0, -100},
+        T3DVec3{100, 0, 0},
+        T3DVec3{0, 0, 100}
+    };
+
+    PlyNum ply = (PlyNum)playerData.size();
+    playerData.emplace_back(Player {startPositions[ply], ply, model.get(), shadowModel.get()});
+    if (playerData.size() < PlayerCount) return false;
+
+    newRound();
+    return true;
+}
+
 void GameplayController::simulatePhysics(
     Player &player,
     uint32_t id,
@@ -162,24 +185,23 @@ void GameplayController::render(float deltaTime, T3DViewport &viewport, GameStat
     int id = 0;
     for (auto& player : playerData)
     {
-        Direction dir = NONE;
         if (id < (int)core_get_playercount()) {
             joypad_buttons_t pressed = joypad_get_buttons_pressed(core_get_playercontroller((PlyNum)id));
 
-            if (pressed.c_up || pressed.d_up) {
-                dir = UP;
-            } else if (pressed.c_down || pressed.d_down) {
-                dir = DOWN;
-            } else if (pressed.c_left || pressed.d_left) {
-                dir = LEFT;
-            } else if (pressed.c_right || pressed.d_right) {
-                dir = RIGHT;
+            // Presses are edge triggered, keep the first one until a tick consumes it
+            if (pendingFire[id] == NONE) {
+                if (pressed.c_up || pressed.d_up) {
+                    pendingFire[id] = UP;
+                } else if (pressed.c_down || pressed.d_down) {
+                    pendingFire[id] = DOWN;
+                } else if (pressed.c_left || pressed.d_left) {
+                    pendingFire[id] = LEFT;
+                } else if (pressed.c_right || pressed.d_right) {
+                    pendingFire[id] = RIGHT;
+                }
             }
-        } else {
-            dir = ai.calculateFireDirection(player, deltaTime, playerData, state);
         }
 
-        if (state.state == STATE_GAME || state.state == STATE_LAST_ONE_STANDING) handleFire(player, id, dir);
         player.render(id, viewport, deltaTime, *map);
 
         t3d_vec3_add(state.avPos, state.avPos, player.pos);
@@ -193,36 +215,59 @@ void GameplayController::render(float deltaTime, T3DViewport &viewport, GameStat
     }
 }
 
-void GameplayController::renderUI()
+void GameplayController::renderUI(OverlayBatcher &overlay)
 {
     int i = 0;
     for (auto& player : playerData)
     {
-        player.renderUI(i, arrowSprite.get());
+        player.renderUI(i, arrowSprite.get(), overlay);
         i++;
     }
 }
 
 void GameplayController::fixedUpdate(float deltaTime, GameState &state)
 {
+    influence.fixedUpdate(deltaTime, map->getHalfSize());
+
+    gatherInputs(deltaTime, state);
+
+    bool canFire = state.state == STATE_GAME || state.state == STATE_LAST_ONE_STANDING;
+
+    uint32_t id = 0;
+    for (auto& player : playerData)
+    {
+        TickInput &input = tickInputs[id];
+        if (canFire) handleFire(player, id, input.fire);
+        simulatePhysics(player, id, deltaTime, input.movement);
+        id++;
+    }
+
+    if (state.state == STATE_GAME || state.state == STATE_LAST_ONE_STANDING) {
+        bulletController.fixedUpdate(deltaTime, playerData, influence);
+    }
+}
+
+void GameplayController::gatherInputs(float deltaTime, GameState &state)
+{
+    // Decide for every player first, so all of them act on the same snapshot of the tick
     uint32_t id = 0;
     for (auto& player : playerData)
     {
-        T3DVec3 direction = {0};
+        TickInput &input = tickInputs[id];
+        input.movement = {0};
         if (id < core_get_playercount()) {
             joypad_inputs_t joypad = joypad_get_inputs(core_get_playercontroller((PlyNum)id));
-            direction.v[0] = (float)joypad.stick_x;
-            direction.v[2] = -(float)joypad.stick_y;
+            input.movement.v[0] = (float)joypad.stick_x;
+            input.movement.v[2] = -(float)joypad.stick_y;
+
+            input.fire = pendingFire[id];
+            pendingFire[id] = NONE;
         } else {
-            ai.calculateMovement(player, deltaTime, playerData, state, direction);
+            ai[id].calculateMovement(player, deltaTime, playerData, state, influence, input.movement);
+            input.fire = ai[id].calculateFireDirection(player, deltaTime, playerData, state);
         }
-        simulatePhysics(player, id, deltaTime, direction);
         id++;
     }
-
-    if (state.state == STATE_GAME || state.state == STATE_LAST_ONE_STANDING) {
-        bulletController.fixedUpdate(deltaTime, playerData);
-    }
 }
 
 void GameplayController::newRound()
@@ -234,10 +279,11 @@ void GameplayController::newRound()
         T3DVec3{0, 0, 100}
     };
 
-    auto rd = std::random_device {}; 
-    auto rng = std::default_random_engine { rd() };
+    auto rng = std::default_random_engine { core_rng_next(spawnRng) };
     std::shuffle(std::begin(playerPositions), std::end(playerPositions), rng);
 
+    influence.newRound();
+
     PlyNum ply = PLAYER_1;
     for (Player &player : playerData)
     {
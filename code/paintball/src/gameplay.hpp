@@ -24,11 +24,18 @@
 #include "ui.hpp"
 #include "gamestate.hpp"
 #include "ai.hpp"
+#include "influence.hpp"
 #include "common.hpp"
 
 constexpr float PlayerInvMass = 10;
 constexpr float BulletOffset = 15.f;
 
+// Everything a player decided for a single fixed tick
+struct TickInput {
+    T3DVec3 movement;
+    Direction fire;
+};
+
 class GameplayController
 {
     private:
@@ -41,9 +48,16 @@ class GameplayController
         // Player data
         std::vector<Player> playerData;
 
+        // Human fire presses are latched by the render loop until the next tick consumes them
+        std::array<Direction, PlayerCount> pendingFire;
+        std::array<TickInput, PlayerCount> tickInputs;
+
         // Controllers
         std::shared_ptr<MapRenderer> map;
-        AI ai;
+        InfluenceMap influence;
+        std::vector<AI> ai;
+
+        CoreRng *spawnRng;
 
         // Player calculations
         void simulatePhysics(
@@ -53,14 +67,16 @@ class GameplayController
             T3DVec3 &inputDirection
         );
         void handleFire(Player &player, uint32_t id, Direction direction);
+        void gatherInputs(float deltaTime, GameState &state);
 
     public:
-        GameplayController(std::shared_ptr<MapRenderer> map, std::shared_ptr<UIRenderer> ui);
+        GameplayController(std::shared_ptr<MapRenderer> map, std::shared_ptr<UIRenderer> ui, const AIParamSet &aiParams);
+        bool addPlayer();
         void newRound();
         const std::vector<Player> &getPlayerData() const;
 
         void render(float deltaTime, T3DViewport &viewport, GameState &state);
-        void renderUI();
+        void renderUI(OverlayBatcher &overlay);
         void fixedUpdate(float deltaTime, GameState &state);
 };
 
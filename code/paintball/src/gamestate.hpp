@@ -3,6 +3,8 @@
 
 #include "../../../core.h"
 
+#include "./constants.hpp"
+
 enum State
 {
     STATE_COUNTDOWN,
@@ -13,11 +15,20 @@ enum State
     STATE_PAUSED,
 };
 
+struct RoundStats
+{
+    float length;
+    int captures;
+    PlyNum winner;
+};
+
 struct GameState
 {
     State state;
     float timeInState;
     float gameTime;
+    // Unlike gameTime, keeps counting through last one standing
+    float roundTime;
 
     int currentRound;
 
@@ -25,6 +36,8 @@ struct GameState
     PlyNum winner;
 
     T3DVec3 avPos;
+
+    RoundStats rounds[RoundCount];
 };
 
 #endif // __GAMESTATE_H
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "influence.hpp"
+
+InfluenceMap::InfluenceMap() :
+    boundaryHalfSize(-1.f)
+{
+    for (auto &layer : ownership) {
+        layer.fill(0.f);
+    }
+    boundary.fill(0.f);
+    newRound();
+}
+
+void InfluenceMap::newRound() {
+    for (auto &layer : danger) {
+        layer.fill(0.f);
+    }
+    // Paint persists across rounds, so does the ownership layer
+}
+
+int InfluenceMap::cellIndex(int x, int y) {
+    if (x < 0) x = 0;
+    if (x >= InfluenceGridSize) x = InfluenceGridSize - 1;
+    if (y < 0) y = 0;
+    if (y >= InfluenceGridSize) y = InfluenceGridSize - 1;
+    return y * InfluenceGridSize + x;
+}
+
+int InfluenceMap::toCell(float v) {
+    return (int)floorf((v + InfluenceHalfExtent) / InfluenceCellSize);
+}
+
+void InfluenceMap::stamp(Layer &layer, float x, float z, float value) {
+    int cx = toCell(x);
+    int cy = toCell(z);
+    if (cx < 0 || cx >= InfluenceGridSize || cy < 0 || cy >= InfluenceGridSize) return;
+
+    float &cell = layer[cellIndex(cx, cy)];
+    cell = std::min(1.f, cell + value);
+}
+
+void InfluenceMap::updateBoundary(float halfSize) {
+    // Only rebuild once the boundary has moved by a meaningful fraction of a cell
+    if (std::abs(halfSize - boundaryHalfSize) < InfluenceCellSize / 4.f) return;
+    boundaryHalfSize = halfSize;
+
+    for (int iy = 0; iy < InfluenceGridSize; iy++) {
+        for (int ix = 0; ix < InfluenceGridSize; ix++) {
+            float x = (ix + 0.5f) * InfluenceCellSize - InfluenceHalfExtent;
+            float z = (iy + 0.5f) * InfluenceCellSize - InfluenceHalfExtent;
+            float distance = halfSize - std::max(std::abs(x), std::abs(z));
+
+            float pressure = 1.f - distance / InfluenceBoundaryRange;
+            if (pressure < 0.f) pressure = 0.f;
+            if (pressure > 1.f) pressure = 1.f;
+            boundary[cellIndex(ix, iy)] = pressure;
+        }
+    }
+}
+
+void InfluenceMap::fixedUpdate(float deltaTime, float halfSize) {
+    float decay = powf(InfluenceDangerDecayPerSecond, deltaTime);
+    for (auto &layer : danger) {
+        for (auto &cell : layer) {
+            cell *= decay;
+        }
+    }
+
+    updateBoundary(halfSize);
+}
+
+void InfluenceMap::addBullet(const T3DVec3 &pos, const T3DVec3 &velocity, PlyNum team) {
+    // Mark where the bullet is and where it will be shortly, so AIs react before it arrives
+    stamp(danger[team], pos.v[0], pos.v[2], 1.f);
+    stamp(
+        danger[team],
+        pos.v[0] + velocity.v[0] * InfluenceDangerLookahead,
+        pos.v[2] + velocity.v[2] * InfluenceDangerLookahead,
+        1.f
+    );
+}
+
+void InfluenceMap::addPaint(float x, float z, PlyNum team) {
+    int cx = toCell(x);
+    int cy = toCell(z);
+    if (cx < 0 || cx >= InfluenceGridSize || cy < 0 || cy >= InfluenceGridSize) return;
+
+    int idx = cellIndex(cx, cy);
+    for (int i = 0; i < PlayerCount; i++) {
+        float &cell = ownership[i][idx];
+        if (i == team) {
+            cell = std::min(1.f, cell + InfluencePaintStrength);
+        } else {
+            cell = std::max(0.f, cell - InfluencePaintStrength);
+        }
+    }
+}
+
+float InfluenceMap::sampleDanger(int x, int y, PlyNum team) const {
+    int idx = cellIndex(x, y);
+    float value = 0.f;
+    for (int i = 0; i < PlayerCount; i++) {
+        if (i == team) continue;
+        value += danger[i][idx];
+    }
+    return value;
+}
+
+float InfluenceMap::sampleOwnership(int x, int y, PlyNum team) const {
+    int idx = cellIndex(x, y);
+    float value = 0.f;
+    for (int i = 0; i < PlayerCount; i++) {
+        value += (i == team) ? ownership[i][idx] : -ownership[i][idx] / (PlayerCount - 1);
+    }
+    return value;
+}
+
+InfluenceSample InfluenceMap::sample(const T3DVec3 &pos, PlyNum team) const {
+    int cx = toCell(pos.v[0]);
+    int cy = toCell(pos.v[2]);
+
+    // Central differences over the 4-neighbourhood, constant cost per query
+    float dangerX = sampleDanger(cx + 1, cy, team) - sampleDanger(cx - 1, cy, team);
+    float dangerY = sampleDanger(cx, cy + 1, team) - sampleDanger(cx, cy - 1, team);
+
+    float ownX = sampleOwnership(cx + 1, cy, team) - sampleOwnership(cx - 1, cy, team);
+    float ownY = sampleOwnership(cx, cy + 1, team) - sampleOwnership(cx, cy - 1, team);
+
+    float boundX = boundary[cellIndex(cx + 1, cy)] - boundary[cellIndex(cx - 1, cy)];
+    float boundY = boundary[cellIndex(cx, cy + 1)] - boundary[cellIndex(cx, cy - 1)];
+
+    return InfluenceSample {
+        .danger = T3DVec3 {{-dangerX, 0.f, -dangerY}},
+        .territory = T3DVec3 {{ownX, 0.f, ownY}},
+        .boundary = T3DVec3 {{-boundX, 0.f, -boundY}},
+    };
+}
@@ -0,0 +1,67 @@
+#ifndef __INFLUENCE_H
+#define __INFLUENCE_H
+
+#include <libdragon.h>
+
+#include <t3d/t3dmath.h>
+
+#include <array>
+#include <algorithm>
+
+#include "../../../core.h"
+
+#include "./constants.hpp"
+#include "./map.hpp"
+
+// One cell per map segment, covering the whole arena
+constexpr int InfluenceGridSize = MapWidth / TileSize;
+constexpr float InfluenceCellSize = SegmentSize;
+constexpr float InfluenceHalfExtent = InfluenceGridSize * InfluenceCellSize / 2.f;
+
+// Danger left by a bullet halves roughly every 0.2s
+constexpr float InfluenceDangerDecayPerSecond = 0.03f;
+constexpr float InfluenceDangerLookahead = 0.3f;
+constexpr float InfluencePaintStrength = 0.25f;
+constexpr float InfluenceBoundaryRange = 2.f * InfluenceCellSize;
+
+struct InfluenceSample {
+    // Direction away from enemy bullets, scaled by how dangerous it is
+    T3DVec3 danger;
+    // Direction towards the player's own team paint
+    T3DVec3 territory;
+    // Direction away from the shrinking boundary
+    T3DVec3 boundary;
+};
+
+class InfluenceMap
+{
+    private:
+        using Layer = std::array<float, InfluenceGridSize * InfluenceGridSize>;
+
+        // Danger is kept per firing team, so teammates' bullets are ignored
+        std::array<Layer, PlayerCount> danger;
+        std::array<Layer, PlayerCount> ownership;
+        Layer boundary;
+
+        float boundaryHalfSize;
+
+        static int cellIndex(int x, int y);
+        static int toCell(float v);
+
+        void stamp(Layer &layer, float x, float z, float value);
+        void updateBoundary(float halfSize);
+        float sampleDanger(int x, int y, PlyNum team) const;
+        float sampleOwnership(int x, int y, PlyNum team) const;
+
+    public:
+        InfluenceMap();
+        void newRound();
+        void fixedUpdate(float deltaTime, float halfSize);
+
+        void addBullet(const T3DVec3 &pos, const T3DVec3 &velocity, PlyNum team);
+        void addPaint(float x, float z, PlyNum team);
+
+        InfluenceSample sample(const T3DVec3 &pos, PlyNum team) const;
+};
+
+#endif // __INFLUENCE_H
@@ -15,7 +15,9 @@ MapRenderer::MapRenderer() :
     tlut {
         (uint16_t*)malloc_uncached(sizeof(uint16_t[256])),
         free_uncached
-    }
+    },
+    rng(core_rng_get("paintball.map")),
+    fxRng(core_rng_get("paintball.map.fx"))
 {
     debugf("Map renderer initialized\n");
     assertf(surface.get(), "surface is null");
@@ -136,7 +138,7 @@ void MapRenderer::render(float deltaTime, const T3DFrustum &frustum) {
     }
     newFootsteps.clear();
 
-    rspq_block_run(renderModeBlock.get());
+    core_trace_block_run(renderModeBlock.get(), "map");
 
     for (int iy = 0; iy < MapWidth/TileSize; iy++) {
         for (int ix = 0; ix < MapWidth/TileSize; ix++ ) {
@@ -187,22 +189,22 @@ void MapRenderer::__splash(Splash &splash) {
     if (splash.y > MapWidth - safeMargin) return;
     if (splash.y < safeMargin) return;
 
-    int id = randomRange(0, SplashVariations - 1);
+    int id = core_rng_range(fxRng, 0, SplashVariations - 1);
     surface_t s = sprite_get_pixels(splashSprites[id].get());
 
     rdpq_attach(surface.get(), nullptr);
-        rspq_block_run(paintBlock.get());
+        core_trace_block_run(paintBlock.get(), "paint");
 
         rdpq_set_scissor(splash.x - safeMargin, splash.y - safeMargin, splash.x + safeMargin, splash.y + safeMargin);
         rdpq_blitparms_t params {
             .width = 32,
             .height = 32,
-            .flip_x = (bool)randomRange(0, 1),
+            .flip_x = (bool)core_rng_range(fxRng, 0, 1),
             .flip_y = true,
             .cx = 16,
             .cy = 16,
-            .scale_x = 0.8f + static_cast<float>(rand()) / RAND_MAX,
-            .scale_y = 0.8f + static_cast<float>(rand()) / RAND_MAX,
+            .scale_x = 0.8f + core_rng_float(fxRng),
+            .scale_y = 0.8f + core_rng_float(fxRng),
             .theta = splash.direction,
         };
         // Set all channels to the same value b/c for an I8 target, RDP will
@@ -228,7 +230,7 @@ void MapRenderer::__step(Splash &step) {
     surface_t s = sprite_get_pixels(footstep.get());
 
     rdpq_attach(surface.get(), nullptr);
-        rspq_block_run(paintBlock.get());
+        core_trace_block_run(paintBlock.get(), "paint");
 
         rdpq_set_scissor(step.x - 16, step.y - 16, step.x + 16, step.y + 16);
         rdpq_blitparms_t params {
@@ -263,7 +265,7 @@ void MapRenderer::splash(float x, float y, PlyNum team, float direction) {
         finalX,
         finalY,
         team,
-        direction + T3D_DEG_TO_RAD(45 * static_cast<float>(rand()) / RAND_MAX),
+        direction + T3D_DEG_TO_RAD(45 * core_rng_float(rng)),
         false
     });
 }
@@ -55,6 +55,10 @@ class MapRenderer
         // As a ratio of the maximum map size
         float mapSize;
 
+        // Fixed-tick gameplay draws from rng, render-time cosmetics from fxRng
+        CoreRng *rng;
+        CoreRng *fxRng;
+
         void __splash(Splash &splash);
         void __step(Splash &);
     public:
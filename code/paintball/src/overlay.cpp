@@ -0,0 +1,55 @@
+#include "./overlay.hpp"
+
+void OverlayBatcher::add(sprite_t *sprite, color_t color, uint8_t alpha, float x, float y, float theta) {
+    items.add(OverlayItem {sprite, color, alpha, x, y, theta});
+}
+
+void OverlayBatcher::submit() {
+    if (items.begin() == items.end()) return;
+
+    std::sort(items.begin(), items.end(), [](const OverlayItem &a, const OverlayItem &b) {
+        if (a.sprite != b.sprite) return a.sprite < b.sprite;
+        if (a.alpha != b.alpha) return a.alpha < b.alpha;
+        return color_to_packed32(a.color) < color_to_packed32(b.color);
+    });
+
+    rdpq_sync_pipe();
+    rdpq_sync_tile();
+    rdpq_set_mode_standard();
+
+    rdpq_mode_zbuf(false, false);
+    rdpq_mode_alphacompare(1);
+    rdpq_mode_combiner(RDPQ_COMBINER1((ZERO, ZERO, ZERO, PRIM), (ZERO, ZERO, ZERO, TEX0)));
+
+    int alpha = -1;
+    uint32_t color = 0;
+    bool hasColor = false;
+    for (auto item = items.begin(); item != items.end(); ++item) {
+        if (item->alpha != alpha) {
+            alpha = item->alpha;
+            if (alpha == 255) {
+                rdpq_mode_blender(0);
+            } else {
+                rdpq_mode_blender(RDPQ_BLENDER_MULTIPLY_CONST);
+                rdpq_set_fog_color(RGBA32(0, 0, 0, alpha));
+            }
+        }
+
+        if (!hasColor || color_to_packed32(item->color) != color) {
+            color = color_to_packed32(item->color);
+            hasColor = true;
+            rdpq_set_prim_color(item->color);
+        }
+
+        rdpq_blitparms_t params {
+            .width = item->sprite->width,
+            .height = item->sprite->height,
+            .cx = item->sprite->width / 2,
+            .cy = item->sprite->height / 2,
+            .theta = item->theta,
+        };
+        rdpq_sprite_blit(item->sprite, item->x, item->y, &params);
+    }
+
+    items.clear();
+}
@@ -0,0 +1,36 @@
+#ifndef __OVERLAY_H
+#define __OVERLAY_H
+
+#include <libdragon.h>
+
+#include <algorithm>
+
+#include "./constants.hpp"
+#include "./list.hpp"
+
+// Hit marks plus one arrow per player
+constexpr int OverlayLimit = PlayerCount * 4 + PlayerCount;
+
+struct OverlayItem {
+    sprite_t *sprite;
+    color_t color;
+    // Anything below 255 is multiplied onto the background
+    uint8_t alpha;
+    float x;
+    float y;
+    float theta;
+};
+
+// Collects 2D sprite draws for a frame and submits them grouped by sprite
+// and color, so the render mode is only set up once per group.
+class OverlayBatcher
+{
+    private:
+        List<OverlayItem, OverlayLimit> items;
+
+    public:
+        void add(sprite_t *sprite, color_t color, uint8_t alpha, float x, float y, float theta = 0.f);
+        void submit();
+};
+
+#endif // __OVERLAY_H
@@ -9,11 +9,18 @@ Player::Player(T3DVec3 pos, PlyNum team, T3DModel *model, T3DModel *shadowModel)
     accel({0}),
     velocity({0}),
     direction(0),
-    block({nullptr, rspq_block_free}),
-    matFP({(T3DMat4FP*)malloc_uncached(sizeof(T3DMat4FP)), free_uncached}),
+    matFP({core_framering_new(DisplayBufferCount, sizeof(T3DMat4FP), 1), core_framering_free}),
     skel(model),
+    boneMatFP({core_framering_new(DisplayBufferCount, sizeof(T3DMat4FP) * skel.get()->skeletonRef->boneCount, 1), core_framering_free}),
     animWalk(model, "Walk"),
+    animTime(0),
+    poseDirtySlots((1u << DisplayBufferCount) - 1),
     screenPos({0}),
+    label({
+        .width = 20,
+        .align = ALIGN_CENTER,
+        .disable_aa_fix = true
+    }),
     displayTemperature(0),
     timer(0),
     firstStep(true),
@@ -25,9 +32,15 @@ Player::Player(T3DVec3 pos, PlyNum team, T3DModel *model, T3DModel *shadowModel)
         assertf(skel.get(), "Player skel is null");
         assertf(animWalk.get(), "Player animWalk is null");
         assertf(matFP.get(), "Player matrix is null");
-
-        rspq_block_begin();
-            t3d_matrix_push(matFP.get());
+        assertf(boneMatFP.get(), "Player bone matrices are null");
+
+        // The matrix is pushed outside the block, it changes every frame. The block bakes
+        // in the bone matrix address, so every frame in flight gets its own block.
+        skel.freeOwnMatrices();
+        blocks.reserve(DisplayBufferCount);
+        for (int i = 0; i < DisplayBufferCount; i++) {
+            skel.get()->boneMatricesFP = (T3DMat4FP*)core_framering_get_at(boneMatFP.get(), i, 0);
+            rspq_block_begin();
                 rdpq_mode_zbuf(true, true);
 
                 T3DModelIter it = t3d_model_iter_create(model, T3D_CHUNK_TYPE_OBJECT);
@@ -59,9 +72,8 @@ Player::Player(T3DVec3 pos, PlyNum team, T3DModel *model, T3DModel *shadowModel)
 
                 rdpq_set_prim_color(RGBA32(0, 0, 0, 120));
                 t3d_model_draw(shadowModel);
-
-            t3d_matrix_pop(1);
-        block = U::RSPQBlock(rspq_block_end(), rspq_block_free);
+            blocks.emplace_back(rspq_block_end(), rspq_block_free);
+        }
 
         t3d_anim_attach(animWalk.get(), skel.get());
     }
@@ -80,13 +92,32 @@ void Player::render(uint32_t id, T3DViewport &viewport, float deltaTime, MapRend
         PLAYERCOLOR_4,
     };
 
-    assertf(matFP.get(), "Player %lu matrix is null", id);
-    assertf(block.get(), "Player %lu block is null", id);
+    int slot = core_framering_get_buffer(boneMatFP.get());
+    assertf(blocks[slot].get(), "Player %lu block is null", id);
     assertf(animWalk.get(), "Player %lu animWalk is null", id);
     assertf(skel.get(), "Player %lu skel is null", id);
 
+    // Animation LOD: idle players keep their last pose, players out of view advance their
+    // animation at a reduced rate and only rebuild the skeleton once they're back in view
     auto anim = animWalk.get();
-    t3d_anim_update(anim, deltaTime);
+    bool moving = t3d_vec3_len2(velocity) > AnimIdleSpeed * AnimIdleSpeed;
+    t3d_anim_set_playing(anim, moving);
+
+    T3DVec3 boundsMin {0};
+    T3DVec3 boundsMax {0};
+    T3DVec3 extent {{AnimBoundsHalfExtent, AnimBoundsHalfExtent, AnimBoundsHalfExtent}};
+    t3d_vec3_diff(boundsMin, currentPos, extent);
+    t3d_vec3_add(boundsMax, currentPos, extent);
+    bool visible = t3d_frustum_vs_aabb(&viewport.viewFrustum, &boundsMin, &boundsMax);
+
+    animTime += deltaTime;
+    if (!moving) {
+        animTime = 0.f;
+    } else if (visible || animTime >= AnimOffscreenInterval) {
+        t3d_anim_update(anim, animTime);
+        animTime = 0.f;
+        poseDirtySlots = (1u << DisplayBufferCount) - 1;
+    }
 
     float currentAnimTime = fmod(anim->time, anim->animRef->duration);
     if((currentAnimTime > 0.f && currentAnimTime <= (anim->animRef->duration/2.f)) && firstStep) {
@@ -97,7 +128,13 @@ void Player::render(uint32_t id, T3DViewport &viewport, float deltaTime, MapRend
         firstStep = true;
     } 
 
-    t3d_skeleton_update(skel.get());
+    // Every frame in flight has its own copy of the pose, so a new pose is written
+    // into each slot as it comes up while the RSP may still read the previous ones
+    if (visible && (poseDirtySlots & (1u << slot))) {
+        skel.get()->boneMatricesFP = (T3DMat4FP*)core_framering_get(boneMatFP.get(), 0);
+        t3d_skeleton_update(skel.get());
+        poseDirtySlots &= ~(1u << slot);
+    }
 
     bool hidden = false;
     float temp = temperature;
@@ -122,8 +159,10 @@ void Player::render(uint32_t id, T3DViewport &viewport, float deltaTime, MapRend
 
     displayTemperature = t3d_lerp(displayTemperature, factor, 0.2);
 
+    // Written into this frame's slot, the RSP may still be reading the previous ones
+    T3DMat4FP *mat = (T3DMat4FP*)core_framering_get(matFP.get(), 0);
     t3d_mat4fp_from_srt_euler(
-        matFP.get(),
+        mat,
         (float[3]){0.12f+displayTemperature, 0.12f+displayTemperature, 0.12f+displayTemperature},
         (float[3]){0.0f, direction, 0},
         currentPos.v
@@ -133,7 +172,9 @@ void Player::render(uint32_t id, T3DViewport &viewport, float deltaTime, MapRend
     rdpq_set_prim_color(colors[team]);
 
     rdpq_set_env_color(colors[firstHit]);
-    rspq_block_run(block.get());
+    t3d_matrix_push(mat);
+        core_trace_block_run(blocks[slot].get(), "player");
+    t3d_matrix_pop(1);
 
     T3DVec3 billboardPos = (T3DVec3){{
         currentPos.v[0],
@@ -144,7 +185,7 @@ void Player::render(uint32_t id, T3DViewport &viewport, float deltaTime, MapRend
     t3d_viewport_calc_viewspace_pos(viewport, screenPos, billboardPos);
 }
 
-void Player::renderUI(uint32_t id, sprite_t *arrowSprite)
+void Player::renderUI(uint32_t id, sprite_t *arrowSprite, OverlayBatcher &overlay)
 {
     constexpr int margin = ScreenWidth / 10;
     int x = floorf(screenPos.v[0]);
@@ -171,11 +212,7 @@ void Player::renderUI(uint32_t id, sprite_t *arrowSprite)
         theta = T3D_PI;
     }
 
-    rdpq_sync_pipe();
-    rdpq_sync_tile();
     if (theta != 0.f) {
-        rdpq_set_mode_standard();
-
         const color_t colors[] = {
             PLAYERCOLOR_1,
             PLAYERCOLOR_2,
@@ -183,42 +220,18 @@ void Player::renderUI(uint32_t id, sprite_t *arrowSprite)
             PLAYERCOLOR_4,
         };
 
-        rdpq_mode_zbuf(false, false);
-        rdpq_mode_alphacompare(1);
-        rdpq_mode_blender(RDPQ_BLENDER_MULTIPLY_CONST);
-        rdpq_set_fog_color(RGBA32(0, 0, 0, 200));
-        rdpq_mode_combiner(RDPQ_COMBINER1((ZERO, ZERO, ZERO, PRIM), (ZERO, ZERO, ZERO, TEX0)));
-
-        rdpq_set_prim_color(colors[id]);
-
-        rdpq_blitparms_t params {
-            .width = 32,
-            .height = 32,
-            .cx = 16,
-            .cy = 16,
-            .theta = theta,
-        };
-        rdpq_sprite_blit(arrowSprite, x, y, &params);
+        // Drawn later together with the other overlay sprites
+        overlay.add(arrowSprite, colors[id], 200, x, y, theta);
     } else {
+        rdpq_sync_pipe();
+        rdpq_sync_tile();
+
         constexpr int textHalfWidth = 10;
         constexpr int textHalfHeight = 6;
         int x = floorf(screenPos.v[0]) - textHalfWidth;
         int y = floorf(screenPos.v[1]) - textHalfHeight;
-        rdpq_textparms_t fontParams {
-            .style_id = (int16_t)id,
-            .width = 20,
-            .align = ALIGN_CENTER,
-            .disable_aa_fix = true
-        };
-        rdpq_text_printf(
-            &fontParams,
-            SmallFont,
-            x,
-            y,
-            "P%lu", //%d
-            id + 1//,
-            // aiState
-        );
+        label.set(SmallFont, (int16_t)id, "P%d", (int)id + 1);
+        label.render(x, y);
     }
 
     // if (temperature > 0.5f) {
@@ -20,6 +20,8 @@
 #include "list.hpp"
 #include "bullet.hpp"
 #include "map.hpp"
+#include "text.hpp"
+#include "overlay.hpp"
 
 enum AIState {
     AI_IDLE,
@@ -68,14 +70,19 @@ class Player
 
         // Renderer
         float direction;
-        U::RSPQBlock block;
-        U::T3DMat4FP matFP;
+        std::vector<U::RSPQBlock> blocks;
+        U::FrameRing matFP;
 
         T3D::Skeleton skel;
+        U::FrameRing boneMatFP;
 
         T3D::Anim animWalk;
+        float animTime;
+        // One bit per bone matrix slot still holding an older pose
+        uint32_t poseDirtySlots;
 
         T3DVec3 screenPos;
+        CachedText label;
 
         float displayTemperature;
         float timer;
@@ -91,7 +98,7 @@ class Player
     public:
         Player(T3DVec3 pos, PlyNum team, T3DModel *model, T3DModel *shadowModel);
         void render(uint32_t id, T3DViewport &viewport, float deltaTime, MapRenderer&);
-        void renderUI(uint32_t id, sprite_t *arrowSprite);
+        void renderUI(uint32_t id, sprite_t *arrowSprite, OverlayBatcher &overlay);
         void acceptHit(const Bullet &bullet);
 };
 
@@ -0,0 +1,65 @@
+#include "./text.hpp"
+
+// The pack holds the sizes in font id order, see paintball.mk
+FontFamily::FontFamily() :
+    pack({core_fontpack_load("rom:/paintball/FingerPaint.fontpack"), core_fontpack_free})
+{
+    assertf(core_fontpack_count(pack.get()) == BigFont - SmallFont + 1, "Font pack has the wrong sizes");
+    for (int id = SmallFont; id <= BigFont; id++) {
+        rdpq_font_t *font = core_fontpack_get(pack.get(), id - SmallFont);
+        applyStyles(font);
+        rdpq_text_register_font(id, font);
+    }
+}
+
+FontFamily::~FontFamily() {
+    for (int id = SmallFont; id <= BigFont; id++) {
+        rdpq_text_unregister_font(id);
+    }
+}
+
+void FontFamily::applyStyles(rdpq_font_t *font) {
+    static const rdpq_fontstyle_t styles[] = {
+        { .color = PLAYERCOLOR_1 },
+        { .color = PLAYERCOLOR_2 },
+        { .color = PLAYERCOLOR_3 },
+        { .color = PLAYERCOLOR_4 },
+        { .color = RGBA32(255, 255, 180, 255) },
+    };
+
+    assertf(font, "Font is null");
+    for (int i = 0; i < (int)(sizeof(styles) / sizeof(styles[0])); i++) {
+        rdpq_font_style(font, i, &styles[i]);
+    }
+}
+
+CachedText::CachedText(const rdpq_textparms_t &parms) :
+    parms(parms),
+    font(0),
+    text({0}),
+    paragraph({nullptr, rdpq_paragraph_free}) {}
+
+void CachedText::set(uint8_t font, int16_t style, const char *format, ...) {
+    std::array<char, CachedTextLength> buffer {0};
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer.data(), buffer.size(), format, args);
+    va_end(args);
+
+    if (paragraph.get() && this->font == font && parms.style_id == style && !strcmp(buffer.data(), text.data())) {
+        return;
+    }
+
+    this->font = font;
+    parms.style_id = style;
+    text = buffer;
+
+    int nbytes = strlen(text.data());
+    paragraph = U::Paragraph(rdpq_paragraph_build(&parms, font, text.data(), &nbytes), rdpq_paragraph_free);
+}
+
+void CachedText::render(float x, float y) {
+    assertf(paragraph.get(), "Text is not set");
+    rdpq_paragraph_render(paragraph.get(), x, y);
+}
@@ -0,0 +1,45 @@
+#ifndef __TEXT_H
+#define __TEXT_H
+
+#include <libdragon.h>
+
+#include <array>
+#include <cstdarg>
+#include <cstring>
+
+#include "./wrappers.hpp"
+#include "./constants.hpp"
+
+constexpr int CachedTextLength = 32;
+
+// The same typeface at every size the game uses, loaded from one font pack
+// and all sharing one style table
+class FontFamily
+{
+    private:
+        U::FontPack pack;
+
+        void applyStyles(rdpq_font_t *font);
+
+    public:
+        FontFamily();
+        ~FontFamily();
+};
+
+// Keeps the layout of a short string around and only rebuilds it when the
+// font, style or string changes. The layout can be drawn at any position.
+class CachedText
+{
+    private:
+        rdpq_textparms_t parms;
+        uint8_t font;
+        std::array<char, CachedTextLength> text;
+        U::Paragraph paragraph;
+
+    public:
+        CachedText(const rdpq_textparms_t &parms);
+        void set(uint8_t font, int16_t style, const char *format, ...) __attribute__((format(printf, 4, 5)));
+        void render(float x, float y);
+};
+
+#endif // __TEXT_H
@@ -1,36 +1,37 @@
 #include "./ui.hpp"
 
+namespace {
+    const rdpq_textparms_t CenterParms {
+        .style_id = 4,
+        .width = ScreenWidth,
+        .height = ScreenHeight,
+        .align = ALIGN_CENTER,
+        .valign = VALIGN_CENTER,
+        .disable_aa_fix = true
+    };
+
+    const rdpq_textparms_t StandCountdownParms {
+        .style_id = 4,
+        .width = (int16_t)(ScreenWidth * 0.8),
+        .height = (int16_t)(ScreenHeight * 0.8),
+        .align = ALIGN_RIGHT,
+        .valign = VALIGN_BOTTOM,
+        .disable_aa_fix = true
+    };
+}
+
 UIRenderer::UIRenderer() :
-    mediumFont("rom:/paintball/FingerPaint-Regular-Medium.font64", MediumFont),
-    bigFont("rom:/paintball/FingerPaint-Regular-Big.font64", BigFont),
     hitSprite {sprite_load("rom:/paintball/marker.ia4.sprite"), sprite_free},
     sfxCountdown("rom:/core/Countdown.wav64"),
-    prevCountdown(0)
+    prevCountdown(0),
+    title(CenterParms),
+    subtitle(CenterParms),
+    countdown(CenterParms),
+    standCountdown(StandCountdownParms),
+    roundCounter(CenterParms),
+    scores {CenterParms, CenterParms, CenterParms, CenterParms},
+    boardScores {CenterParms, CenterParms, CenterParms, CenterParms}
 {
-    rdpq_fontstyle_t p1Style = { .color = PLAYERCOLOR_1 };
-    rdpq_fontstyle_t p2Style = { .color = PLAYERCOLOR_2 };
-    rdpq_fontstyle_t p3Style = { .color = PLAYERCOLOR_3 };
-    rdpq_fontstyle_t p4Style = { .color = PLAYERCOLOR_4 };
-
-    auto fnt = mediumFont.font.get();
-    assertf(fnt, "MediumFont is null");
-
-    rdpq_fontstyle_t style = { .color = RGBA32(255, 255, 180, 255) };
-
-    rdpq_font_style(fnt, 4, &style);
-    rdpq_font_style(fnt, 0, &p1Style);
-    rdpq_font_style(fnt, 1, &p2Style);
-    rdpq_font_style(fnt, 2, &p3Style);
-    rdpq_font_style(fnt, 3, &p4Style);
-
-    fnt = bigFont.font.get();
-    assertf(fnt, "BigFont is null");
-
-    rdpq_font_style(fnt, 4, &style);
-    rdpq_font_style(fnt, 0, &p1Style);
-    rdpq_font_style(fnt, 1, &p2Style);
-    rdpq_font_style(fnt, 2, &p3Style);
-    rdpq_font_style(fnt, 3, &p4Style);
 }
 
 State UIRenderer::renderMenu(const State &state) {
@@ -71,16 +72,8 @@ State UIRenderer::renderMenu(const State &state) {
 
 void UIRenderer::render(GameState &state, T3DViewport &viewport, float deltaTime)
 {
-    rdpq_textparms_t centerparms = {
-        .style_id = 4,
-        .width = ScreenWidth,
-        .height = ScreenHeight,
-        .align = ALIGN_CENTER,
-        .valign = VALIGN_CENTER,
-        .disable_aa_fix = true
-    };
-
     renderHitMarks(viewport, deltaTime);
+    overlay.submit();
 
     rdpq_sync_tile();
     rdpq_sync_pipe(); // Hardware crashes otherwise
@@ -90,60 +83,61 @@ void UIRenderer::render(GameState &state, T3DViewport &viewport, float deltaTime
 
     if (state.state == STATE_COUNTDOWN) {
         if (state.currentRound == (RoundCount-1)) {
-            rdpq_text_printf(&centerparms, MediumFont, 0, - ScreenHeight / 4, "Final Round");
+            title.set(MediumFont, 4, "Final Round");
         } else {
-            rdpq_text_printf(&centerparms, MediumFont, 0, - ScreenHeight / 4, "Round %d", state.currentRound + 1);
+            title.set(MediumFont, 4, "Round %d", state.currentRound + 1);
         }
-        int countdown = (int)ceilf(3.f - state.timeInState);
-        if (countdown != prevCountdown) {
+        title.render(0, - ScreenHeight / 4);
+
+        int count = (int)ceilf(3.f - state.timeInState);
+        if (count != prevCountdown) {
             wav64_play(sfxCountdown.get(), GeneralPurposeAudioChannel);
-            prevCountdown = countdown;
+            prevCountdown = count;
         }
-        rdpq_text_printf(&centerparms, BigFont, 0, 0, "%d", (int)ceilf(3.f - state.timeInState));
+        countdown.set(BigFont, 4, "%d", count);
+        countdown.render(0, 0);
 
-        rdpq_text_printf(&centerparms, SmallFont, 0, - ScreenHeight / 8, "^04Prepare to paint!");
+        subtitle.set(SmallFont, 4, "^04Prepare to paint!");
+        subtitle.render(0, - ScreenHeight / 8);
     } else if(state.state == STATE_GAME && state.timeInState < 0.6f){
-        rdpq_text_printf(&centerparms, BigFont, 0, 0, "Go!");
+        title.set(BigFont, 4, "Go!");
+        title.render(0, 0);
     } else if(state.state == STATE_LAST_ONE_STANDING){
         if(state.timeInState < 3.f) {
-            rdpq_text_printf(&centerparms, MediumFont, 0, - ScreenHeight / 4, "Final stand!");
-            rdpq_text_printf(&centerparms, SmallFont, 0, - ScreenHeight / 8, "^04Don't let them escape!");
+            title.set(MediumFont, 4, "Final stand!");
+            title.render(0, - ScreenHeight / 4);
+            subtitle.set(SmallFont, 4, "^04Don't let them escape!");
+            subtitle.render(0, - ScreenHeight / 8);
         }
 
         if(state.state == STATE_LAST_ONE_STANDING && state.timeInState < LastOneStandingTime){
-            rdpq_textparms_t textparms3 = {
-                .style_id = 4,
-                .width = (int16_t)(ScreenWidth * 0.8),
-                .height = (int16_t)(ScreenHeight * 0.8),
-                .align = ALIGN_RIGHT,
-                .valign = VALIGN_BOTTOM,
-                .disable_aa_fix = true
-            };
-
-            rdpq_text_printf(&textparms3, MediumFont, ScreenWidth * 0.1, ScreenHeight * 0.1, "%d", (int)ceilf(LastOneStandingTime - state.timeInState));
+            standCountdown.set(MediumFont, 4, "%d", (int)ceilf(LastOneStandingTime - state.timeInState));
+            standCountdown.render(ScreenWidth * 0.1, ScreenHeight * 0.1);
         }
     } else if (state.state == STATE_FINISHED) {
-        centerparms.style_id = state.winner;
-        rdpq_text_printf(&centerparms, BigFont, 0, - ScreenHeight / 3, "Winner!");
+        title.set(BigFont, state.winner, "Winner!");
+        title.render(0, - ScreenHeight / 3);
 
         for (int i = 0; i < MAXPLAYERS; i++) {
-            centerparms.style_id = i;
-            rdpq_text_printf(&centerparms, MediumFont, 0, (i-1) * 30, "Player %d: %d", i + 1, state.scores[i]);
+            boardScores[i].set(MediumFont, i, "Player %d: %d", i + 1, state.scores[i]);
+            boardScores[i].render(0, (i-1) * 30);
         }
     } else if (state.state == STATE_WAIT_FOR_NEW_ROUND) {
-        rdpq_text_printf(&centerparms, BigFont, 0, - ScreenHeight / 3, "Player %d wins!", state.winner + 1);
+        title.set(BigFont, 4, "Player %d wins!", state.winner + 1);
+        title.render(0, - ScreenHeight / 3);
 
         for (int i = 0; i < MAXPLAYERS; i++) {
-            centerparms.style_id = i;
-            rdpq_text_printf(&centerparms, MediumFont, 0, (i-1) * 30, "Player %d: %d", i + 1, state.scores[i]);
+            boardScores[i].set(MediumFont, i, "Player %d: %d", i + 1, state.scores[i]);
+            boardScores[i].render(0, (i-1) * 30);
         }
     }
 
     if(state.state != STATE_WAIT_FOR_NEW_ROUND && state.state != STATE_FINISHED){
-        rdpq_text_printf(&centerparms, SmallFont, -5 * ScreenWidth/16, 3 * ScreenHeight / 8, "%d/%d", state.currentRound + 1, RoundCount);
+        roundCounter.set(SmallFont, 4, "%d/%d", state.currentRound + 1, RoundCount);
+        roundCounter.render(-5 * ScreenWidth/16, 3 * ScreenHeight / 8);
         for (int i = 0; i < MAXPLAYERS; i++) {
-            centerparms.style_id = i;
-            rdpq_text_printf(&centerparms, SmallFont, ((i-1) * 2 - 1) * ScreenWidth/16, 3 * ScreenHeight / 8, "P%d: %d", i + 1, state.scores[i]);
+            scores[i].set(SmallFont, i, "P%d: %d", i + 1, state.scores[i]);
+            scores[i].render(((i-1) * 2 - 1) * ScreenWidth/16, 3 * ScreenHeight / 8);
         }
     }
 }
@@ -168,26 +162,14 @@ void UIRenderer::renderHitMarks(T3DViewport &viewport, float deltaTime) {
         T3DVec3 screenPos;
         t3d_viewport_calc_viewspace_pos(viewport, screenPos, hit->pos);
 
-        rdpq_sync_pipe();
-        rdpq_sync_tile();
-        rdpq_set_mode_standard();
-
-        rdpq_mode_zbuf(false, false);
-        rdpq_mode_alphacompare(1);
-        rdpq_mode_combiner(RDPQ_COMBINER1((ZERO, ZERO, ZERO, PRIM), (ZERO, ZERO, ZERO, TEX0)));
-
-        rdpq_set_prim_color(colors[hit->team]);
-
-        rdpq_blitparms_t params {
-            .width = 32,
-            .height = 32,
-            .cx = 16,
-            .cy = 16,
-        };
-        rdpq_sprite_blit(hitSprite.get(), screenPos.v[0], screenPos.v[1], &params);
+        overlay.add(hitSprite.get(), colors[hit->team], 255, screenPos.v[0], screenPos.v[1]);
     }
 }
 
+OverlayBatcher &UIRenderer::getOverlay() {
+    return overlay;
+}
+
 void UIRenderer::registerHit(const HitMark &hit) {
     hits.add(HitMark {hit.pos, hit.team, 0.1f});
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "./constants.hpp"
 #include "./gamestate.hpp"
 #include "./list.hpp"
+#include "./text.hpp"
+#include "./overlay.hpp"
 
 #include "../../../minigame.h"
 
@@ -24,16 +26,23 @@ enum SelectedMenuItem {
 class UIRenderer
 {
     private:
-        RDPQFont mediumFont;
-        RDPQFont bigFont;
-
         U::Sprite hitSprite;
 
         List<HitMark, PlayerCount * 4> hits;
+        OverlayBatcher overlay;
 
         Wav64 sfxCountdown;
         int prevCountdown;
 
+        // Only laid out again when their contents change
+        CachedText title;
+        CachedText subtitle;
+        CachedText countdown;
+        CachedText standCountdown;
+        CachedText roundCounter;
+        std::array<CachedText, PlayerCount> scores;
+        std::array<CachedText, PlayerCount> boardScores;
+
         void renderHitMarks(T3DViewport &viewport, float deltaTime);
 
         State renderMenu(const State &state);
@@ -45,6 +54,7 @@ class UIRenderer
         void render(GameState &state, T3DViewport &viewport, float deltaTime);
 
         void registerHit(const HitMark &hit);
+        OverlayBatcher &getOverlay();
 };
 
 #endif // __UI_HPP
\ No newline at end of file
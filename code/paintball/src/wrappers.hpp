@@ -8,18 +8,18 @@
 #include <t3d/t3danim.h>
 #include <t3d/t3dmodel.h>
 
+#include "../../../core.h"
+#include "./constants.hpp"
+
 class Display
 {
     private:
     public:
         const surface_t* depthBuffer;
+        // The core sets the display up from minigame_def and keeps it alive across transitions
         Display() {
-            display_init(RESOLUTION_320x240, DEPTH_16_BPP, 3, GAMMA_NONE, FILTERS_RESAMPLE);
             depthBuffer = display_get_zbuf();
         };
-        ~Display() {
-            display_close();
-        };
 };
 
 class T3D
@@ -29,24 +29,39 @@ class T3D
     {
         private:
             T3DSkeleton skel = {0};
+            // boneMatricesFP can be pointed at other buffers, this is the one to free
+            T3DMat4FP* ownMatrices = nullptr;
         public:
             Skeleton(const T3DModel *model) {
                 skel = t3d_skeleton_create(model);
+                ownMatrices = skel.boneMatricesFP;
             };
 
             // Everything is a copy, we allocate these once anyways
             Skeleton(Skeleton&& rhs) {
                 skel = *rhs.get();
+                ownMatrices = rhs.ownMatrices;
                 rhs.skel = {0};
+                rhs.ownMatrices = nullptr;
             };
 
             Skeleton& operator=(Skeleton&& rhs) {
                 skel = *rhs.get();
+                ownMatrices = rhs.ownMatrices;
                 rhs.skel = {0};
+                rhs.ownMatrices = nullptr;
                 return *this;
             };
 
+            // For when boneMatricesFP is always pointed at buffers owned elsewhere
+            void freeOwnMatrices() {
+                free_uncached(ownMatrices);
+                ownMatrices = nullptr;
+                skel.boneMatricesFP = nullptr;
+            };
+
             ~Skeleton() {
+                skel.boneMatricesFP = ownMatrices;
                 t3d_skeleton_destroy(&skel);
             };
 
@@ -85,10 +100,10 @@ class T3D
     };
 
     T3D() {
-        t3d_init((T3DInitParams){});
+        core_t3d_acquire();
     };
     ~T3D() {
-        t3d_destroy();
+        core_t3d_release();
     };
 };
 
@@ -145,6 +160,8 @@ class Wav64
 namespace U {
     using RSPQBlock = std::unique_ptr<rspq_block_t, decltype(&rspq_block_free)>;
     using T3DMat4FP = std::unique_ptr<T3DMat4FP, decltype(&free_uncached)>;
+    using FrameRing = std::unique_ptr<CoreFrameRing, decltype(&core_framering_free)>;
+    using FontPack = std::unique_ptr<CoreFontPack, decltype(&core_fontpack_free)>;
     using T3DSkeleton = std::unique_ptr<T3DSkeleton, decltype(&t3d_skeleton_destroy)>;
     using T3DAnim = std::unique_ptr<T3DAnim, decltype(&t3d_anim_destroy)>;
     using T3DModel = std::unique_ptr<T3DModel, decltype(&t3d_model_free)>;
@@ -153,6 +170,7 @@ namespace U {
     // Would be nice to use a vector, see https://stackoverflow.com/questions/11896960/custom-allocator-in-stdvector
     using TLUT = std::unique_ptr<uint16_t, decltype(&free_uncached)>;
     using T3DVertPacked = std::unique_ptr<T3DVertPacked, decltype(&free_uncached)>;
+    using Paragraph = std::unique_ptr<rdpq_paragraph_t, decltype(&rdpq_paragraph_free)>;
 }
 
 #endif // __WRAPPERS_H
\ No newline at end of file
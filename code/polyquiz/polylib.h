@@ -0,0 +1,60 @@
+#ifndef POLYQUIZ_POLYLIB_H
+#define POLYQUIZ_POLYLIB_H
+
+#include <stdint.h>
+
+// Library of polyhedra generated at build time by tools/polyquiz-library.
+// Everything is stored big-endian, so the console uses it as read.
+//
+// File:  PolyLibHeader, then uint32_t offsets[count + 1] from the start of
+//        the file (entry i spans offsets[i] to offsets[i+1]), then entries.
+// Entry: PolyLibEntry
+//        float positions[num_vertices][3]
+//        uint8_t edges[num_edges][2], padded to a multiple of 4 bytes
+//        PolyVertex vertices[num_faces * 3]
+
+#define POLYLIB_MAGIC    0x504C4942  // "PLIB"
+#define POLYLIB_VERSION  1
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+} PolyLibHeader;
+
+typedef struct {
+    uint16_t num_vertices;
+    uint16_t num_faces;
+    uint16_t num_edges;
+    uint16_t padding;
+} PolyLibEntry;
+
+// Faces are flat shaded, so each one gets its own three vertices carrying
+// the face normal and color
+typedef struct {
+    float position[3];
+    int8_t normal[4];       // Last byte is padding
+    uint8_t color[4];
+} PolyVertex;
+
+typedef struct {
+    float r, g, b;
+} Color;
+
+static const Color palette[] = {
+    {0.894f, 0.102f, 0.110f},  // Rosso brillante
+    {0.216f, 0.494f, 0.722f},  // Blu brillante
+    {0.302f, 0.686f, 0.290f},  // Verde brillante
+    {0.596f, 0.306f, 0.639f},  // Viola
+    {1.000f, 0.498f, 0.000f},  // Arancione
+    {1.000f, 1.000f, 0.200f},  // Giallo
+    {0.651f, 0.337f, 0.157f},  // Marrone
+    {0.968f, 0.505f, 0.749f},  // Rosa
+};
+#define PALETTE_SIZE (sizeof(palette) / sizeof(palette[0]))
+
+static inline uint32_t polylib_edges_size(int num_edges) {
+    return (num_edges * 2 + 3) & ~3;
+}
+
+#endif
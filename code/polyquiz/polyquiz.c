@@ -4,58 +4,52 @@
 #include <GL/gl.h>
 #include <GL/glu.h>
 #include <GL/gl_integration.h>
+#include "polylib.h"
 
-#define MAX_VERTICES 100
-#define MAX_FACES 200
 #define NUM_BKGS 20
 
+// Draws every edge on top of the faces. Without a depth buffer this
+// shows the back edges too, so it's a debugging aid only.
+#define DEBUG_WIREFRAME 0
+
 #define MAX_TIME  20.0f
 #define FADEIN_TIME 2.0f
 #define FADEOUT_TIME 3.0f
 
+// Nothing here needs more, the drawing extrapolates the animation
+#define POLYQUIZ_TICKRATE 15
+// The AI guesses moved one step per tick at 30 Hz, keep that speed
+#define AI_GUESS_STEP (30 / POLYQUIZ_TICKRATE)
+
 const MinigameDef minigame_def = {
     .gamename = "Polyquiz",
     .developername = "Rasky",
     .description = "Simple OpenGL game. Can you guess how many faces a polyhedron has?",
     .instructions = "D-Pad to change your guess, A to confirm",
+    .tickrate = POLYQUIZ_TICKRATE,
+    .resolution = RESOLUTION_640x480,
+    .depth = DEPTH_16_BPP,
+    .buffers = 2,
+    .filters = FILTERS_RESAMPLE_ANTIALIAS,
 };
 
-typedef struct {
-    float r, g, b;
-} Color;
-
-typedef struct {
-    float x, y, z;
-} Vertex;
-
-typedef struct {
-    int v1, v2, v3;
-    int color_idx;
-} Face;
-
-Color palette[] = {
-    {0.894f, 0.102f, 0.110f},  // Rosso brillante
-    {0.216f, 0.494f, 0.722f},  // Blu brillante
-    {0.302f, 0.686f, 0.290f},  // Verde brillante
-    {0.596f, 0.306f, 0.639f},  // Viola
-    {1.000f, 0.498f, 0.000f},  // Arancione
-    {1.000f, 1.000f, 0.200f},  // Giallo
-    {0.651f, 0.337f, 0.157f},  // Marrone
-    {0.968f, 0.505f, 0.749f},  // Rosa
-};
-#define PALETTE_SIZE (sizeof(palette) / sizeof(palette[0]))
-
-Color random_color_from_palette() {
-    int index = rand() % PALETTE_SIZE;
-    return palette[index];
-}
+CoreRng *shape_rng;
+CoreRng *ai_rng;
 
-Vertex vertices[MAX_VERTICES];
-Face faces[MAX_FACES];
+// Polyhedra are generated at build time, only the one being shown is read
+FILE *polylib = NULL;
+uint32_t *polylib_offsets = NULL;
+int polylib_count = 0;
+PolyLibEntry *poly_entry = NULL;
+float (*positions)[3];
+uint8_t (*edges)[2];
 int num_vertices = 0;
 int num_faces = 0;
-rspq_block_t *poly = NULL;
-sprite_t *bkg[NUM_BKGS];
+int num_edges = 0;
+GLuint poly_buffer = 0;
+
+// A session shows a single background, so only that one is loaded
+sprite_t *bkg = NULL;
 rdpq_font_t *font = NULL;
 #define FONT_TEXT 1
 
@@ -84,9 +78,9 @@ struct {
 } player[4];
 
 void generateRandomAxis() {
-    axisX = ((float)rand() / RAND_MAX) * 2.0f - 1.0f;
-    axisY = ((float)rand() / RAND_MAX) * 2.0f - 1.0f;
-    axisZ = ((float)rand() / RAND_MAX) * 2.0f - 1.0f;
+    axisX = core_rng_float(shape_rng) * 2.0f - 1.0f;
+    axisY = core_rng_float(shape_rng) * 2.0f - 1.0f;
+    axisZ = core_rng_float(shape_rng) * 2.0f - 1.0f;
 
     float length = sqrtf(axisX * axisX + axisY * axisY + axisZ * axisZ);
     if (length > 0.0f) {
@@ -96,159 +90,87 @@ void generateRandomAxis() {
     }
 }
 
-Vertex random_vertex(float range_min, float range_max) {
-    Vertex v;
+void polylib_open(void) {
+    polylib = fopen("rom:/polyquiz/polyhedra.bin", "rb");
+    assertf(polylib, "Cannot open the polyhedron library");
 
-    float radius = (range_max - range_min)/2;
-    float theta = ((float)rand() / RAND_MAX) * 2.0f * 3.1415628f;
-    float phi = acosf(1.0f - 2.0f * ((float)rand() / RAND_MAX));
+    PolyLibHeader header;
+    fread(&header, sizeof(header), 1, polylib);
+    assertf(header.magic == POLYLIB_MAGIC && header.version == POLYLIB_VERSION,
+        "Invalid polyhedron library (version %d)", header.version);
 
-    v.x = radius * sinf(phi) * cosf(theta);
-    v.y = radius * sinf(phi) * sinf(theta);
-    v.z = radius * cosf(phi);
-
-    return v;
-}
-
-Vertex cross_product(Vertex v1, Vertex v2) {
-    Vertex result;
-    result.x = v1.y * v2.z - v1.z * v2.y;
-    result.y = v1.z * v2.x - v1.x * v2.z;
-    result.z = v1.x * v2.y - v1.y * v2.x;
-    return result;
+    polylib_count = header.count;
+    polylib_offsets = malloc((polylib_count + 1) * sizeof(uint32_t));
+    fread(polylib_offsets, sizeof(uint32_t), polylib_count + 1, polylib);
 }
 
-Vertex subtract(Vertex v1, Vertex v2) {
-    Vertex result;
-    result.x = v1.x - v2.x;
-    result.y = v1.y - v2.y;
-    result.z = v1.z - v2.z;
-    return result;
+void polylib_close(void) {
+    free(poly_entry);
+    free(polylib_offsets);
+    fclose(polylib);
+    poly_entry = NULL;
+    polylib_offsets = NULL;
+    polylib = NULL;
 }
 
-float dot_product(Vertex v1, Vertex v2) {
-    return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
-}
-
-int is_convex(Vertex p, Vertex q, Vertex r, Vertex s) {
-    Vertex pq = subtract(q, p);
-    Vertex pr = subtract(r, p);
-    Vertex ps = subtract(s, p);
-    Vertex n = cross_product(pq, pr);
-    return dot_product(n, ps) >= 0;
-}
-
-// Gift Wrapping (Jarvis March) for 3D convex hull
-void compute_convex_hull() {
-    assertf(num_vertices >= 4, "Too few points to create a polyhedron");
-
-    num_faces = 0;
-    
-    // Staring point: find the leftmost point
-    int start = 0;
-    for (int i = 1; i < num_vertices; i++) {
-        if (vertices[i].x < vertices[start].x) {
-            start = i;
-        }
-    }
-
-    int p = start;
-    do {
-        for (int i = 0; i < num_vertices; i++) {
-            for (int j = i + 1; j < num_vertices; j++) {
-                if (i != p && j != p) {
-                    int found = 1;
-                    for (int k = 0; k < num_vertices; k++) {
-                        if (k != p && k != i && k != j && !is_convex(vertices[p], vertices[i], vertices[j], vertices[k])) {
-                            found = 0;
-                            break;
-                        }
-                    }
-                    if (found) {
-                        faces[num_faces].v1 = p;
-                        faces[num_faces].v2 = i;
-                        faces[num_faces].v3 = j;
-                        num_faces++;
-                    }
-                }
-            }
-        }
-        p++;
-        if (p == num_vertices) {
-            p = 0;
-        }
-    } while (p != start && num_faces < MAX_FACES);
-}
-
-void color_polyhedron(void) {
-    int are_faces_adjacent(Face *f1, Face *f2) {
-        int shared_vertices = 0;
-        if (f1->v1 == f2->v1 || f1->v1 == f2->v2 || f1->v1 == f2->v3) shared_vertices++;
-        if (f1->v2 == f2->v1 || f1->v2 == f2->v2 || f1->v2 == f2->v3) shared_vertices++;
-        if (f1->v3 == f2->v1 || f1->v3 == f2->v2 || f1->v3 == f2->v3) shared_vertices++;
-
-        return (shared_vertices == 2);
-    }    
-    
-    int is_valid_color(Face *faces, int face_index, int color_index, int num_faces) {
-        for (int i = 0; i < num_faces; i++) {
-            if (i == face_index) continue;
-            if (are_faces_adjacent(&faces[face_index], &faces[i]) && faces[i].color_idx == color_index)
-                return false;
-        }
-        return true;
-    }
-
-
-    for (int i = 0; i < num_faces; i++) {
-        int idx = rand() % PALETTE_SIZE;
-        for (int c = 0; c < PALETTE_SIZE; c++) {
-            if (is_valid_color(faces, i, (idx+c)%PALETTE_SIZE, num_faces)) {
-                faces[i].color_idx = (idx+c) % PALETTE_SIZE;
-                break;
-            }
-        }
-    }
+void load_polyhedron(int index) {
+    uint32_t size = polylib_offsets[index+1] - polylib_offsets[index];
+
+    // The whole entry comes in with a single read, and is already laid out the way it's used
+    free(poly_entry);
+    poly_entry = malloc(size);
+    fseek(polylib, polylib_offsets[index], SEEK_SET);
+    fread(poly_entry, 1, size, polylib);
+
+    num_vertices = poly_entry->num_vertices;
+    num_faces = poly_entry->num_faces;
+    num_edges = poly_entry->num_edges;
+    positions = (float (*)[3])(poly_entry + 1);
+    edges = (uint8_t (*)[2])(positions + num_vertices);
+    PolyVertex *vertices = (PolyVertex*)((uint8_t*)edges + polylib_edges_size(num_edges));
+
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB, poly_buffer);
+    glBufferDataARB(GL_ARRAY_BUFFER_ARB, num_faces * 3 * sizeof(PolyVertex), vertices, GL_STATIC_DRAW_ARB);
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
 }
 
 void draw_polyhedron(void)
 {
-    glBegin(GL_TRIANGLES);
-    for (int i = 0; i < num_faces; i++) {
-        Vertex v1 = vertices[faces[i].v1];
-        Vertex v2 = vertices[faces[i].v2];
-        Vertex v3 = vertices[faces[i].v3];
-
-        Vertex normal;
-        normal.x = (v2.y - v1.y) * (v3.z - v1.z) - (v2.z - v1.z) * (v3.y - v1.y);
-        normal.y = (v2.z - v1.z) * (v3.x - v1.x) - (v2.x - v1.x) * (v3.z - v1.z);
-        normal.z = (v2.x - v1.x) * (v3.y - v1.y) - (v2.y - v1.y) * (v3.x - v1.x);
-
-        glNormal3f(normal.x, normal.y, normal.z);
-        Color color = palette[faces[i].color_idx];
-        glColor4f(color.r, color.g, color.b, 0.8f);
-
-        glVertex3f(v1.x, v1.y, v1.z);
-        glVertex3f(v2.x, v2.y, v2.z);
-        glVertex3f(v3.x, v3.y, v3.z);
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB, poly_buffer);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+
+    glVertexPointer(3, GL_FLOAT, sizeof(PolyVertex), (void*)offsetof(PolyVertex, position));
+    glNormalPointer(GL_BYTE, sizeof(PolyVertex), (void*)offsetof(PolyVertex, normal));
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(PolyVertex), (void*)offsetof(PolyVertex, color));
+    glDrawArrays(GL_TRIANGLES, 0, num_faces * 3);
+
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glDisableClientState(GL_COLOR_ARRAY);
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+
+#if DEBUG_WIREFRAME
+    glDisable(GL_LIGHTING);
+    glBegin(GL_LINES);
+    glColor4f(0.0f, 0.0f, 0.0f, 1.0f);
+    for (int i = 0; i < num_edges; i++) {
+        glVertex3fv(positions[edges[i][0]]);
+        glVertex3fv(positions[edges[i][1]]);
     }
     glEnd();
+    glEnable(GL_LIGHTING);
+#endif
 }
 
-void generate_random_polyhedron(int num_vertices_input, float range_min, float range_max) {
-    num_vertices = num_vertices_input;
-    for (int i = 0; i < num_vertices; i++) {
-        vertices[i] = random_vertex(range_min, range_max);
-    }
-    compute_convex_hull();
-    color_polyhedron();
-
-    if (poly) rspq_block_free(poly);
-    rspq_block_begin();
-        draw_polyhedron();
-    poly = rspq_block_end();
+void generate_random_polyhedron(void) {
+    load_polyhedron(core_rng_range(shape_rng, 0, polylib_count-1));
 
-    cur_bkg = rand() % NUM_BKGS;
+    cur_bkg = core_rng_range(shape_rng, 0, NUM_BKGS-1);
+    char fn[64];
+    sprintf(fn, "rom:/polyquiz/plaster%d.ci4.sprite", cur_bkg+1);
+    bkg = sprite_load(fn);
 }
 
 float gauss_random(float mean, float stddev) {
@@ -263,8 +185,8 @@ float gauss_random(float mean, float stddev) {
     has_spare = 1;
     float u, v, s;
     do {
-        u = (rand() / ((float) RAND_MAX)) * 2.0 - 1.0;
-        v = (rand() / ((float) RAND_MAX)) * 2.0 - 1.0;
+        u = core_rng_float(ai_rng) * 2.0 - 1.0;
+        v = core_rng_float(ai_rng) * 2.0 - 1.0;
         s = u * u + v * v;
     } while (s >= 1.0 || s == 0.0);
 
@@ -276,8 +198,8 @@ float gauss_random(float mean, float stddev) {
 float random_gaussian_truncated(float A, float B, float C, float sigma) {
     float x;
     do {
-        float u1 = rand() / (float) RAND_MAX;
-        float u2 = rand() / (float) RAND_MAX;
+        float u1 = 1.0f - core_rng_float(ai_rng);
+        float u2 = core_rng_float(ai_rng);
         float z0 = sqrtf(-2.0 * logf(u1)) * cosf(2.0 * 3.1415628f * u2);
         x = C + sigma * z0;
     } while (x < A || x > B);
@@ -312,8 +234,11 @@ void generate_ai_guesses(void)
 
 void minigame_init()
 {
-    display_init(RESOLUTION_640x480, DEPTH_16_BPP, 2, GAMMA_NONE, FILTERS_RESAMPLE_ANTIALIAS);
+    shape_rng = core_rng_get("polyquiz.shape");
+    ai_rng = core_rng_get("polyquiz.ai");
+
     gl_init();
+    glGenBuffersARB(1, &poly_buffer);
 
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);  // Colore di sfondo
 
@@ -341,14 +266,9 @@ void minigame_init()
     glLoadIdentity();
     gluPerspective(45.0, (GLfloat)w / (GLfloat)h, near_plane, far_plane);
 
-    int num_vertices = rand() % 10 + 5;
-    generate_random_polyhedron(num_vertices, -1.0f, 1.0f);
+    polylib_open();
+    generate_random_polyhedron();
 
-    for (int i=0; i<NUM_BKGS; i++) {
-        char fn[64];
-        sprintf(fn, "rom:/polyquiz/plaster%d.ci4.sprite", i+1);
-        bkg[i] = sprite_load(fn);
-    }
     font = rdpq_font_load("rom:/polyquiz/abaddon.font64");
     rdpq_text_register_font(FONT_TEXT, font);
     rdpq_font_style(font, 0, &(rdpq_fontstyle_t){
@@ -374,12 +294,10 @@ void minigame_cleanup()
 {
     rdpq_text_unregister_font(FONT_TEXT);
     rdpq_font_free(font);
-    for (int i=0; i<NUM_BKGS; i++) {
-        sprite_free(bkg[i]);
-    }
-    if (poly) rspq_block_free(poly);
+    sprite_free(bkg);
+    polylib_close();
+    glDeleteBuffersARB(1, &poly_buffer);
     gl_close();
-    display_close();
 }
 
 void minigame_fixedloop(float dt)
@@ -424,8 +342,13 @@ void minigame_fixedloop(float dt)
         for (int j=0; j<3; j++) {
             if (player[i].ai_guess_times[j] > 0) {
                 int target_guess = player[i].ai_guesses[j] * (1 - player[i].ai_guess_times[j] / MAX_TIME);
-                if (player[i].guess < target_guess) player[i].guess++;
-                if (player[i].guess > target_guess) player[i].guess--;
+                if (player[i].guess < target_guess) {
+                    player[i].guess += AI_GUESS_STEP;
+                    if (player[i].guess > target_guess) player[i].guess = target_guess;
+                } else if (player[i].guess > target_guess) {
+                    player[i].guess -= AI_GUESS_STEP;
+                    if (player[i].guess < target_guess) player[i].guess = target_guess;
+                }
                 break;
             } else if (j == 2 && !player[i].confirmed) {
                 player[i].confirmed = true;
@@ -475,7 +398,7 @@ void minigame_loop(float dt)
     rdpq_attach(disp, NULL);
 
     rdpq_set_mode_copy(false);
-    rdpq_sprite_upload(TILE0, bkg[cur_bkg], &(rdpq_texparms_t){
+    rdpq_sprite_upload(TILE0, bkg, &(rdpq_texparms_t){
         .s.repeats = REPEAT_INFINITE, .t.repeats = REPEAT_INFINITE,
     });
     rdpq_texture_rectangle(TILE0, 0, 0, display_get_width(), display_get_height(), 0, 0);
@@ -488,10 +411,22 @@ void minigame_loop(float dt)
               0.0, 0.0, 0.0,  // Look at
               0.0, 1.0, 0.0); // Up vector
 
-    glScalef(zoom, zoom, zoom);
-    glRotatef(angle, axisX, axisY, axisZ);
+    // Ticks run at a low rate, so extrapolate the animation to this frame
+    float ahead = core_get_subtick() / POLYQUIZ_TICKRATE;
+    float draw_angle = angle, draw_zoom = zoom;
+    switch (state) {
+    case GS_PLAY:    draw_angle += rotationSpeed * ahead; break;
+    case GS_FADEIN:  draw_zoom = 1.0f - ((state_time - ahead) / FADEIN_TIME); break;
+    case GS_FADEOUT: draw_zoom = 1.0f * ((state_time - ahead) / FADEOUT_TIME); break;
+    default: break;
+    }
+    if (draw_zoom < 0.001f) draw_zoom = 0.001f;
+    if (draw_zoom > 1.0f) draw_zoom = 1.0f;
+
+    glScalef(draw_zoom, draw_zoom, draw_zoom);
+    glRotatef(draw_angle, axisX, axisY, axisZ);
 
-    rspq_block_run(poly);
+    draw_polyhedron();
 
     gl_context_end();
 
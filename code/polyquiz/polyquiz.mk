@@ -1,4 +1,5 @@
 ASSETS_LIST += \
+	filesystem/polyquiz/polyhedra.bin \
 	filesystem/polyquiz/abaddon.font64 \
 	filesystem/polyquiz/plaster1.ci4.sprite \
 	filesystem/polyquiz/plaster2.ci4.sprite \
@@ -22,3 +23,17 @@ ASSETS_LIST += \
 	filesystem/polyquiz/plaster20.ci4.sprite
 	
 filesystem/polyquiz/abaddon.font64: MKFONT_FLAGS += --outline 3 --size 32
+
+# The polyhedra are generated on the host, see tools/polyquiz-library.
+# 32 shapes for every face count from 6 to 24, the same range the game
+# used to roll at runtime.
+POLYQUIZ_LIBRARY_DIR = tools/polyquiz-library
+
+$(POLYQUIZ_LIBRARY_DIR)/mkpolylib: $(wildcard $(POLYQUIZ_LIBRARY_DIR)/*.c $(POLYQUIZ_LIBRARY_DIR)/*.h) code/polyquiz/polylib.h
+	@echo "    [HOST] $@"
+	$(MAKE) -C $(POLYQUIZ_LIBRARY_DIR) mkpolylib
+
+filesystem/polyquiz/polyhedra.bin: $(POLYQUIZ_LIBRARY_DIR)/mkpolylib
+	@mkdir -p $(dir $@)
+	@echo "    [POLYHEDRA] $@"
+	$(POLYQUIZ_LIBRARY_DIR)/mkpolylib -f 6-24 -n 32 -s 1 -o $@
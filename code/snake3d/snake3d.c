@@ -8,14 +8,6 @@
 #include <t3d/t3danim.h>
 #include <t3d/t3ddebug.h>
 
-const MinigameDef minigame_def = {
-    .gamename = "Snake3D",
-    .developername = "HailToDodongo",
-    .description = "This is a porting of one of the Tiny3D examples, to show how to "
-                   "integrate Tiny3D in minigame",
-    .instructions = "Press A to attack. Last snake slithering wins!"
-};
-
 #define FONT_TEXT           1
 #define FONT_BILLBOARD      2
 #define TEXT_COLOR          0x6CBB3CFF
@@ -36,6 +28,23 @@ const MinigameDef minigame_def = {
 
 #define BILLBOARD_YOFFSET   15.0f
 
+#define FB_COUNT            3
+
+#define CULL_RADIUS         20.f
+#define OFFSCREEN_ANIM_RATE 0.1f
+
+const MinigameDef minigame_def = {
+    .gamename = "Snake3D",
+    .developername = "HailToDodongo",
+    .description = "This is a porting of one of the Tiny3D examples, to show how to "
+                   "integrate Tiny3D in minigame",
+    .instructions = "Press A to attack. Last snake slithering wins!",
+    .resolution = RESOLUTION_320x240,
+    .depth = DEPTH_16_BPP,
+    .buffers = FB_COUNT,
+    .filters = FILTERS_RESAMPLE_ANTIALIAS,
+};
+
 /**
  * Example project showcasing the usage of the animation system.
  * This includes instancing animations, blending animations, and controlling playback.
@@ -46,7 +55,7 @@ T3DViewport viewport;
 rdpq_font_t *font;
 rdpq_font_t *fontBillboard;
 T3DMat4FP* mapMatFP;
-rspq_block_t *dplMap;
+CoreStaticLayer *staticLayer;
 T3DModel *model;
 T3DModel *modelShadow;
 T3DModel *modelMap;
@@ -58,8 +67,10 @@ xm64player_t music;
 typedef struct
 {
   PlyNum plynum;
-  T3DMat4FP* modelMatFP;
-  rspq_block_t *dplSnake;
+  CoreFrameRing* modelMatFP;
+  CoreFrameRing* boneMatFP;
+  T3DMat4FP* skelMatFP;
+  rspq_block_t *dplSnake[FB_COUNT];
   T3DAnim animAttack;
   T3DAnim animWalk;
   T3DAnim animIdle;
@@ -73,6 +84,7 @@ typedef struct
   bool isAttack;
   bool isAlive;
   float attackTimer;
+  float animTimer;
   PlyNum ai_target;
   int ai_reactionspeed;
 } player_data;
@@ -89,12 +101,10 @@ wav64_t sfx_countdown;
 wav64_t sfx_stop;
 wav64_t sfx_winner;
 
-rspq_syncpoint_t syncPoint;
+CoreRng *aiRng;
 
 void player_init(player_data *player, color_t color, T3DVec3 position, float rotation)
 {
-  player->modelMatFP = malloc_uncached(sizeof(T3DMat4FP));
-
   player->moveDir = (T3DVec3){{0,0,0}};
   player->playerPos = position;
 
@@ -119,38 +129,61 @@ void player_init(player_data *player, color_t color, T3DVec3 position, float rot
   t3d_anim_set_playing(&player->animAttack, false); // start in a paused state
   t3d_anim_attach(&player->animAttack, &player->skel);
 
-  rspq_block_begin();
-    t3d_matrix_push(player->modelMatFP);
-    rdpq_set_prim_color(color);
-    t3d_model_draw_skinned(model, &player->skel); // as in the last example, draw skinned with the main skeleton
+  // Every frame in flight gets its own model and bone matrices, so the CPU never
+  // has to wait for the RSP to finish reading last frame's pose
+  player->modelMatFP = core_framering_new(FB_COUNT, sizeof(T3DMat4FP), 1);
+  player->boneMatFP = core_framering_new(FB_COUNT, sizeof(T3DMat4FP) * player->skel.skeletonRef->boneCount, 1);
+  player->skelMatFP = player->skel.boneMatricesFP;
 
-    rdpq_set_prim_color(RGBA32(0, 0, 0, 120));
-    t3d_model_draw(modelShadow);
-    t3d_matrix_pop(1);
-  player->dplSnake = rspq_block_end();
+  // The skinned draw bakes the bone matrix address into the block, so record one per buffer
+  for (int i = 0; i < FB_COUNT; i++)
+  {
+    player->skel.boneMatricesFP = core_framering_get_at(player->boneMatFP, i, 0);
+    rspq_block_begin();
+      t3d_matrix_push(core_framering_get_at(player->modelMatFP, i, 0));
+      rdpq_set_prim_color(color);
+      t3d_model_draw_skinned(model, &player->skel); // as in the last example, draw skinned with the main skeleton
+
+      rdpq_set_prim_color(RGBA32(0, 0, 0, 120));
+      t3d_model_draw(modelShadow);
+      t3d_matrix_pop(1);
+    player->dplSnake[i] = rspq_block_end();
+  }
 
   player->rotY = rotation;
   player->currSpeed = 0.0f;
   player->animBlend = 0.0f;
   player->isAttack = false;
   player->isAlive = true;
-  player->ai_target = rand()%MAXPLAYERS;
-  player->ai_reactionspeed = (2-core_get_aidifficulty())*5 + rand()%((3-core_get_aidifficulty())*3);
+  player->animTimer = 0.0f;
+  player->ai_target = core_rng_range(aiRng, 0, MAXPLAYERS-1);
+  player->ai_reactionspeed = (2-core_get_aidifficulty())*5 + core_rng_range(aiRng, 0, (3-core_get_aidifficulty())*3-1);
+}
+
+void setup_lights(void)
+{
+  uint8_t colorAmbient[4] = {0xAA, 0xAA, 0xAA, 0xFF};
+  uint8_t colorDir[4]     = {0xFF, 0xAA, 0xAA, 0xFF};
+
+  t3d_light_set_ambient(colorAmbient);
+  t3d_light_set_directional(0, colorDir, &lightDirVec);
+  t3d_light_set_count(1);
 }
 
+static const color_t colors[] = {
+  PLAYERCOLOR_1,
+  PLAYERCOLOR_2,
+  PLAYERCOLOR_3,
+  PLAYERCOLOR_4,
+};
+
 void minigame_init(void)
 {
-  const color_t colors[] = {
-    PLAYERCOLOR_1,
-    PLAYERCOLOR_2,
-    PLAYERCOLOR_3,
-    PLAYERCOLOR_4,
-  };
+  aiRng = core_rng_get("snake3d.ai");
 
-  display_init(RESOLUTION_320x240, DEPTH_16_BPP, 3, GAMMA_NONE, FILTERS_RESAMPLE_ANTIALIAS);
   depthBuffer = display_get_zbuf();
 
-  t3d_init((T3DInitParams){});
+  core_t3d_acquire();
 
   font = rdpq_font_load("rom:/snake3d/m6x11plus.font64");
   rdpq_text_register_font(FONT_TEXT, font);
@@ -180,13 +213,44 @@ void minigame_init(void)
   // Model Credits: Quaternius (CC0) https://quaternius.com/packs/easyenemy.html
   model = t3d_model_load("rom:/snake3d/snake.t3dm");
 
-  rspq_block_begin();
+  // The camera never moves, so the map is only drawn once and copied back every frame
+  t3d_viewport_set_projection(&viewport, T3D_DEG_TO_RAD(90.0f), 20.0f, 160.0f);
+  t3d_viewport_look_at(&viewport, &camPos, &camTarget, &(T3DVec3){{0,1,0}});
+
+  staticLayer = core_staticlayer_new(display_get_width(), display_get_height(), true);
+  core_staticlayer_bake_begin(staticLayer);
+    t3d_frame_start();
+    t3d_viewport_attach(&viewport);
+
+    t3d_screen_clear_color(RGBA32(224, 180, 96, 0xFF));
+    t3d_screen_clear_depth();
+
+    setup_lights();
+
     t3d_matrix_push(mapMatFP);
     rdpq_set_prim_color(RGBA32(255, 255, 255, 255));
     t3d_model_draw(modelMap);
     t3d_matrix_pop(1);
-  dplMap = rspq_block_end();
+  core_staticlayer_bake_end(staticLayer);
+
+  // Nothing reads the map anymore once it's baked
+  t3d_model_free(modelMap);
+  free_uncached(mapMatFP);
+
+  countDownTimer = COUNTDOWN_DELAY;
+
+  wav64_open(&sfx_start, "rom:/core/Start.wav64");
+  wav64_open(&sfx_countdown, "rom:/core/Countdown.wav64");
+  wav64_open(&sfx_stop, "rom:/core/Stop.wav64");
+  wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
+  xm64player_open(&music, "rom:/snake3d/bottled_bubbles.xm64");
+  xm64player_play(&music, 0);
+  mixer_ch_set_vol(31, 0.5f, 0.5f);
+}
 
+// Players record a draw block per framebuffer, so they're set up one per step
+bool minigame_warmup(int step)
+{
   T3DVec3 start_positions[] = {
     (T3DVec3){{-100,0.15f,0}},
     (T3DVec3){{0,0.15f,-100}},
@@ -201,22 +265,9 @@ void minigame_init(void)
     M_PI
   };
 
-  for (size_t i = 0; i < MAXPLAYERS; i++)
-  {
-    player_init(&players[i], colors[i], start_positions[i], start_rotations[i]);
-    players[i].plynum = i;
-  }
-
-  countDownTimer = COUNTDOWN_DELAY;
-
-  syncPoint = 0;
-  wav64_open(&sfx_start, "rom:/core/Start.wav64");
-  wav64_open(&sfx_countdown, "rom:/core/Countdown.wav64");
-  wav64_open(&sfx_stop, "rom:/core/Stop.wav64");
-  wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
-  xm64player_open(&music, "rom:/snake3d/bottled_bubbles.xm64");
-  xm64player_play(&music, 0);
-  mixer_ch_set_vol(31, 0.5f, 0.5f);
+  player_init(&players[step], colors[step], start_positions[step], start_rotations[step]);
+  players[step].plynum = step;
+  return step == MAXPLAYERS-1;
 }
 
 void player_do_damage(player_data *player)
@@ -288,13 +339,13 @@ void player_fixedloop(player_data *player, float deltaTime, joypad_port_t port,
             t3d_anim_set_time(&player->animAttack, 0.0f);
             player->isAttack = true;
             player->attackTimer = 0;
-            player->ai_reactionspeed = (2-core_get_aidifficulty())*5 + rand()%((3-core_get_aidifficulty())*3);
+            player->ai_reactionspeed = (2-core_get_aidifficulty())*5 + core_rng_range(aiRng, 0, (3-core_get_aidifficulty())*3-1);
           } else {
             player->ai_reactionspeed--;
           }
         }
       } else {
-        player->ai_target = rand()%MAXPLAYERS; // (Attempt) to aquire a new target this frame
+        player->ai_target = core_rng_range(aiRng, 0, MAXPLAYERS-1); // (Attempt) to aquire a new target this frame
       }
     }
   }
@@ -343,7 +394,7 @@ void player_loop(player_data *player, float deltaTime, joypad_port_t port, bool
     if (btn.start) minigame_end();
 
     // Player Attack
-    if((btn.a || btn.b) && !player->animAttack.isPlaying) {
+    if((btn.a || btn.b) && !player->isAttack) {
       t3d_anim_set_playing(&player->animAttack, true);
       t3d_anim_set_time(&player->animAttack, 0.0f);
       player->isAttack = true;
@@ -351,26 +402,44 @@ void player_loop(player_data *player, float deltaTime, joypad_port_t port, bool
     }
   }
   
-  // Update the animation and modify the skeleton, this will however NOT recalculate the matrices
-  t3d_anim_update(&player->animIdle, deltaTime);
-  t3d_anim_set_speed(&player->animWalk, player->animBlend + 0.15f);
-  t3d_anim_update(&player->animWalk, deltaTime);
-
-  if(player->isAttack) {
-    t3d_anim_update(&player->animAttack, deltaTime); // attack animation now overrides the idle one
-    if(!player->animAttack.isPlaying)player->isAttack = false;
-  }
+  // Dead snakes aren't drawn anymore, so they don't need any animation work
+  if (!player->isAlive) return;
+
+  // Snakes outside of the view only animate at a reduced rate, catching up on the skipped time.
+  // The frustum is the one of the last attach, which is fine since the camera never moves
+  T3DVec3 boundsMin = {{player->playerPos.v[0] - CULL_RADIUS, player->playerPos.v[1], player->playerPos.v[2] - CULL_RADIUS}};
+  T3DVec3 boundsMax = {{player->playerPos.v[0] + CULL_RADIUS, player->playerPos.v[1] + CULL_RADIUS, player->playerPos.v[2] + CULL_RADIUS}};
+  bool isVisible = t3d_frustum_vs_aabb(&viewport.viewFrustum, &boundsMin, &boundsMax);
 
-  // We now blend the walk animation with the idle/attack one
-  t3d_skeleton_blend(&player->skel, &player->skel, &player->skelBlend, player->animBlend);
+  player->animTimer += deltaTime;
 
-  if(syncPoint)rspq_syncpoint_wait(syncPoint); // wait for the RSP to process the previous frame
+  // The attack is gameplay, so it ends on time even when the animation is held back
+  if (player->isAttack && player->animAttack.time + player->animTimer * player->animAttack.speed >= player->animAttack.animRef->duration)
+    player->isAttack = false;
 
-  // Now recalc. the matrices, this will cause any model referencing them to use the new pose
-  t3d_skeleton_update(&player->skel);
+  if (isVisible || player->animTimer >= OFFSCREEN_ANIM_RATE) {
+    float animDelta = player->animTimer;
+    player->animTimer = 0.0f;
+
+    // Update the animation and modify the skeleton, this will however NOT recalculate the matrices
+    t3d_anim_update(&player->animIdle, animDelta);
+    t3d_anim_set_speed(&player->animWalk, player->animBlend + 0.15f);
+    t3d_anim_update(&player->animWalk, animDelta);
+
+    if(player->animAttack.isPlaying) {
+      t3d_anim_update(&player->animAttack, animDelta); // attack animation now overrides the idle one
+    }
+
+    // We now blend the walk animation with the idle/attack one
+    t3d_skeleton_blend(&player->skel, &player->skel, &player->skelBlend, player->animBlend);
+
+    // Now recalc. the matrices into this frame's buffer, the RSP may still be reading the others
+    player->skel.boneMatricesFP = core_framering_get(player->boneMatFP, 0);
+    t3d_skeleton_update(&player->skel);
+  }
 
   // Update player matrix
-  t3d_mat4fp_from_srt_euler(player->modelMatFP,
+  t3d_mat4fp_from_srt_euler(core_framering_get(player->modelMatFP, 0),
     (float[3]){0.125f, 0.125f, 0.125f},
     (float[3]){0.0f, -player->rotY, 0},
     player->playerPos.v
@@ -380,7 +449,7 @@ void player_loop(player_data *player, float deltaTime, joypad_port_t port, bool
 void player_draw(player_data *player)
 {
   if (player->isAlive) {
-    rspq_block_run(player->dplSnake);
+    core_trace_block_run(player->dplSnake[core_framering_get_buffer(player->boneMatFP)], "snake");
   }
 }
 
@@ -457,9 +526,6 @@ void minigame_fixedloop(float deltaTime)
 
 void minigame_loop(float deltaTime)
 {
-  uint8_t colorAmbient[4] = {0xAA, 0xAA, 0xAA, 0xFF};
-  uint8_t colorDir[4]     = {0xFF, 0xAA, 0xAA, 0xFF};
-
   t3d_viewport_set_projection(&viewport, T3D_DEG_TO_RAD(90.0f), 20.0f, 160.0f);
   t3d_viewport_look_at(&viewport, &camPos, &camTarget, &(T3DVec3){{0,1,0}});
 
@@ -470,25 +536,17 @@ void minigame_loop(float deltaTime)
   }
 
   // ======== Draw (3D) ======== //
-  rdpq_attach(display_get(), depthBuffer);
+  core_staticlayer_attach(staticLayer, display_get(), depthBuffer);
   t3d_frame_start();
   t3d_viewport_attach(&viewport);
 
-  t3d_screen_clear_color(RGBA32(224, 180, 96, 0xFF));
-  t3d_screen_clear_depth();
-
-  t3d_light_set_ambient(colorAmbient);
-  t3d_light_set_directional(0, colorDir, &lightDirVec);
-  t3d_light_set_count(1);
+  setup_lights();
 
-  rspq_block_run(dplMap);
   for (size_t i = 0; i < MAXPLAYERS; i++)
   {
     player_draw(&players[i]);
   }
 
-  syncPoint = rspq_syncpoint_new();
-
   for (size_t i = 0; i < MAXPLAYERS; i++)
   {
     player_draw_billboard(&players[i], i);
@@ -512,7 +570,11 @@ void minigame_loop(float deltaTime)
 
 void player_cleanup(player_data *player)
 {
-  rspq_block_free(player->dplSnake);
+  for (int i = 0; i < FB_COUNT; i++)
+    rspq_block_free(player->dplSnake[i]);
+
+  // The skeleton owns its original matrices, give them back before destroying it
+  player->skel.boneMatricesFP = player->skelMatFP;
 
   t3d_skeleton_destroy(&player->skel);
   t3d_skeleton_destroy(&player->skelBlend);
@@ -521,7 +583,8 @@ void player_cleanup(player_data *player)
   t3d_anim_destroy(&player->animWalk);
   t3d_anim_destroy(&player->animAttack);
 
-  free_uncached(player->modelMatFP);
+  core_framering_free(player->modelMatFP);
+  core_framering_free(player->boneMatFP);
 }
 
 void minigame_cleanup(void)
@@ -537,19 +600,14 @@ void minigame_cleanup(void)
   wav64_close(&sfx_winner);
   xm64player_stop(&music);
   xm64player_close(&music);
-  rspq_block_free(dplMap);
+  core_staticlayer_free(staticLayer);
 
   t3d_model_free(model);
-  t3d_model_free(modelMap);
   t3d_model_free(modelShadow);
 
-  free_uncached(mapMatFP);
-
   rdpq_text_unregister_font(FONT_BILLBOARD);
   rdpq_font_free(fontBillboard);
   rdpq_text_unregister_font(FONT_TEXT);
   rdpq_font_free(font);
-  t3d_destroy();
-
-  display_close();
+  core_t3d_release();
 }
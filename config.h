@@ -25,4 +25,12 @@
     // The current minigame you want to test
     #define MINIGAME_TO_TEST  "examplegame"
 
+    // Seed every minigame's random number streams with this instead of a fresh random seed, to replay
+    // a session exactly. 0 picks a new seed each time, which is logged as "Random seed: ..." to repeat it.
+    #define RNG_SEED  0
+
+    // Record a CPU/RSP/RDP timeline and dump it over the debug log when each minigame ends.
+    // Convert it with tools/trace-convert and open it in chrome://tracing or Perfetto.
+    #define TRACE_CAPTURE  0
+
 #endif
\ No newline at end of file
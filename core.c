@@ -6,8 +6,18 @@ player, AI, and game loop information.
 ***************************************************************/
 
 #include <libdragon.h>
+#include <string.h>
+#include <t3d/t3d.h>
 #include "core.h"
 #include "config.h"
+#include "fontpack.h"
+
+
+/*********************************
+             Macros
+*********************************/
+
+#define CORE_RNG_MAXSTREAMS  16
 
 
 /*********************************
@@ -19,6 +29,37 @@ typedef struct {
     joypad_port_t port;
 } Player;
 
+typedef struct {
+    char name[32];
+    CoreRng rng;
+} CoreRngStream;
+
+struct CoreFrameRing {
+    int buffers;
+    size_t slotsize;
+    int slotcount;
+    uint8_t* data;
+};
+
+typedef struct {
+    resolution_t resolution;
+    bitdepth_t depth;
+    uint32_t buffers;
+    gamma_t gamma;
+    filter_options_t filters;
+} CoreDisplayMode;
+
+struct CoreFontPack {
+    uint8_t* data;
+    int count;
+    rdpq_font_t* fonts[];
+};
+
+struct CoreStaticLayer {
+    surface_t color;
+    surface_t depth;
+};
+
 
 /*********************************
              Globals
@@ -35,6 +76,58 @@ static bool global_core_playeriswinner[MAXPLAYERS];
 // Core info
 static double global_core_subtick = 0;
 
+// Fixed tick scheduler
+static float global_core_tickaccumulator = 0;
+static float global_core_deltatime = DELTATIME;
+static int global_core_maxcatchup = TICK_MAXCATCHUP;
+static CoreTickStats global_core_tickstats;
+
+// Display mode currently set up
+static bool global_core_displayactive = false;
+static CoreDisplayMode global_core_displaymode;
+
+// Tiny3D users, the overlay stays loaded once initialized
+static bool global_core_t3dloaded = false;
+static int global_core_t3drefcount = 0;
+
+// Transition timestamps, in timer ticks
+static uint32_t global_core_transitiontime[TRANSITION_COUNT];
+
+// Trace timeline, see TRACE_CAPTURE
+#if TRACE_CAPTURE
+    #define TRACE_EVENTS  8192
+
+    typedef enum {
+        TRACE_ZONE_BEGIN,
+        TRACE_ZONE_END,
+        TRACE_BLOCK,
+        TRACE_FRAME_BEGIN,
+        TRACE_FRAME_END,
+        TRACE_RDP_DONE,
+        TRACE_VBLANK,
+    } CoreTraceType;
+
+    typedef struct {
+        uint32_t time;
+        uint16_t type;
+        uint16_t frame;
+        const char* name;
+    } CoreTraceEvent;
+
+    static CoreTraceEvent global_core_trace[TRACE_EVENTS];
+    static uint32_t global_core_tracecount = 0;
+    static uint16_t global_core_traceframe = 0;
+    static bool global_core_tracedumping = false;
+#endif
+
+// Frame counter for frame rings
+static uint32_t global_core_frame;
+
+// Random number streams
+static uint32_t global_core_rngseed;
+static CoreRngStream global_core_rngstreams[CORE_RNG_MAXSTREAMS];
+static int global_core_rngstreamcount;
+
 
 /*==============================
     core_get_subtick
@@ -49,6 +142,128 @@ void core_set_subtick(double subtick)
 }
 
 
+/*==============================
+    core_set_maxcatchup
+    Sets how many fixed ticks can run in a single frame
+    @param  The maximum number of ticks per frame
+==============================*/
+
+void core_set_maxcatchup(int ticks)
+{
+    assertf(ticks > 0, "At least one tick per frame is needed\n");
+    global_core_maxcatchup = ticks;
+}
+
+
+/*==============================
+    core_set_tickrate
+    Sets how many fixed ticks run per second
+    @param  The tick rate
+==============================*/
+
+void core_set_tickrate(uint32_t tickrate)
+{
+    global_core_deltatime = 1.0f/(double)tickrate;
+}
+
+
+/*==============================
+    core_tick_reset
+    Resets the fixed tick scheduler for a new minigame
+==============================*/
+
+void core_tick_reset()
+{
+    global_core_tickaccumulator = 0;
+    global_core_maxcatchup = TICK_MAXCATCHUP;
+    memset(&global_core_tickstats, 0, sizeof(CoreTickStats));
+    core_set_subtick(0);
+}
+
+
+/*==============================
+    core_tick_run
+    Runs the fixed ticks that are due this frame. At most
+    global_core_maxcatchup ticks are run, and no more once
+    they took longer than a tick's worth of real time, so a
+    slow tick doesn't snowball into even more ticks next
+    frame. Whatever is still due after that is dropped.
+    @param  The minigame's fixed loop
+    @param  The time the last frame took
+==============================*/
+
+void core_tick_run(void (*fixedloop)(float deltatime), float frametime)
+{
+    const float dt = global_core_deltatime;
+    CoreTickStats* stats = &global_core_tickstats;
+    uint32_t spent_us = 0;
+    int ran = 0;
+
+    global_core_tickaccumulator += frametime;
+    while (global_core_tickaccumulator >= dt && ran < global_core_maxcatchup && spent_us < dt*1000000)
+    {
+        uint32_t start = get_ticks();
+        fixedloop(dt);
+        uint32_t elapsed_us = TICKS_TO_US(get_ticks() - start);
+
+        global_core_tickaccumulator -= dt;
+        spent_us += elapsed_us;
+        ran++;
+
+        stats->ticks++;
+        stats->total_us += elapsed_us;
+        if (elapsed_us > stats->worsttick_us)
+            stats->worsttick_us = elapsed_us;
+    }
+
+    // Fell behind, so let the game run slower rather than freeze in catch-up bursts
+    if (global_core_tickaccumulator >= dt)
+    {
+        uint32_t dropped = global_core_tickaccumulator/dt;
+        stats->dropped += dropped;
+        global_core_tickaccumulator -= dropped*dt;
+    }
+
+    core_set_subtick(((double)global_core_tickaccumulator)/((double)dt));
+}
+
+
+/*==============================
+    core_warmup_run
+    Calls a minigame's warmup steps until it's done,
+    running as many as fit in WARMUP_SLICE_US per frame.
+    A loading screen is shown in between, so the display
+    and the mixer keep going.
+    @param  The minigame's warmup function
+==============================*/
+
+void core_warmup_run(bool (*warmup)(int step))
+{
+    int step = 0;
+    int frame = 0;
+
+    while (1)
+    {
+        bool done;
+        uint32_t start = get_ticks();
+        do
+            done = warmup(step++);
+        while (!done && TICKS_TO_US(get_ticks() - start) < WARMUP_SLICE_US);
+        if (done)
+            break;
+
+        // A block sliding along the bottom, to show we're still alive
+        int width = display_get_width(), height = display_get_height();
+        int x = (frame++ * 4) % (width + 16) - 16;
+        mixer_try_play();
+        rdpq_attach_clear(display_get(), NULL);
+        rdpq_set_mode_fill(RGBA32(255, 255, 255, 255));
+        rdpq_fill_rectangle(x, height - 24, x + 16, height - 16);
+        rdpq_detach_show();
+    }
+}
+
+
 /*==============================
     core_set_playercount
     Sets the number of human players
@@ -127,6 +342,18 @@ double core_get_subtick()
 }
 
 
+/*==============================
+    core_get_tickstats
+    Gets counters about the fixed ticks run so far
+    @return The tick counters
+==============================*/
+
+CoreTickStats core_get_tickstats()
+{
+    return global_core_tickstats;
+}
+
+
 /*==============================
     core_get_playercount
     Get the number of human players
@@ -163,4 +390,563 @@ void core_reset_winners()
 {
     for (int i=0; i<MAXPLAYERS; i++)
         global_core_playeriswinner[i] = false;
+}
+
+/*==============================
+    core_rng_seed
+    Sets the seed of all random number streams, and
+    forgets the streams of the previous minigame
+    @param  The seed
+==============================*/
+
+void core_rng_seed(uint32_t seed)
+{
+    global_core_rngseed = seed;
+    global_core_rngstreamcount = 0;
+}
+
+
+/*==============================
+    core_rng_get_seed
+    Gets the seed the random number streams were
+    created from, so a session can be replayed
+    @return The seed
+==============================*/
+
+uint32_t core_rng_get_seed()
+{
+    return global_core_rngseed;
+}
+
+
+/*==============================
+    core_rng_get
+    Gets a named random number stream, creating it
+    on first use
+    @param  The name of the stream
+    @return The random number stream
+==============================*/
+
+CoreRng* core_rng_get(const char* name)
+{
+    for (int i=0; i<global_core_rngstreamcount; i++)
+        if (!strcmp(global_core_rngstreams[i].name, name))
+            return &global_core_rngstreams[i].rng;
+
+    assertf(global_core_rngstreamcount < CORE_RNG_MAXSTREAMS, "Too many random number streams\n");
+    assertf(strlen(name) < sizeof(global_core_rngstreams[0].name), "Random number stream name too long: %s\n", name);
+
+    CoreRngStream* stream = &global_core_rngstreams[global_core_rngstreamcount++];
+    strcpy(stream->name, name);
+    core_rng_init(&stream->rng, global_core_rngseed, name);
+    return &stream->rng;
+}
+
+
+/*==============================
+    core_display_init
+    Sets up the display, unless it's already in the
+    requested mode
+    @param  The resolution
+    @param  The color depth
+    @param  The number of framebuffers
+    @param  The gamma correction
+    @param  The VI filters
+==============================*/
+
+void core_display_init(resolution_t res, bitdepth_t depth, uint32_t buffers, gamma_t gamma, filter_options_t filters)
+{
+    CoreDisplayMode* cur = &global_core_displaymode;
+    if (global_core_displayactive && !memcmp(&cur->resolution, &res, sizeof(resolution_t)) &&
+        cur->depth == depth && cur->buffers == buffers && cur->gamma == gamma && cur->filters == filters)
+        return;
+
+    if (global_core_displayactive) {
+        rspq_wait();
+        display_close();
+    }
+    display_init(res, depth, buffers, gamma, filters);
+
+    cur->resolution = res;
+    cur->depth = depth;
+    cur->buffers = buffers;
+    cur->gamma = gamma;
+    cur->filters = filters;
+    global_core_displayactive = true;
+}
+
+
+/*==============================
+    core_t3d_acquire
+    Initializes Tiny3D if it isn't loaded yet, and adds
+    a reference to it
+==============================*/
+
+void core_t3d_acquire()
+{
+    if (!global_core_t3dloaded) {
+        t3d_init((T3DInitParams){});
+        global_core_t3dloaded = true;
+    }
+    global_core_t3drefcount++;
+}
+
+
+/*==============================
+    core_t3d_release
+    Removes a reference to Tiny3D. The overlay is kept
+    loaded for the next minigame that needs it
+==============================*/
+
+void core_t3d_release()
+{
+    assertf(global_core_t3drefcount > 0, "core_t3d_release called without a matching core_t3d_acquire\n");
+    global_core_t3drefcount--;
+}
+
+
+/*==============================
+    core_transition_mark
+    Timestamps a point of the menu to minigame transition
+    @param  The point that was reached
+==============================*/
+
+void core_transition_mark(CoreTransitionMark mark)
+{
+    global_core_transitiontime[mark] = get_ticks();
+}
+
+
+/*==============================
+    core_transition_report
+    Logs how long each phase of the last transition took.
+    The line format is parsed by tools/transition-stats,
+    so keep them in sync.
+    @param  The internal name of the minigame
+==============================*/
+
+void core_transition_report(const char* game)
+{
+    static const char* phases[TRANSITION_COUNT] = {NULL, "menu", "load", "init", "warmup", "frame"};
+    uint32_t* t = global_core_transitiontime;
+
+    debugf("[transition] %s", game);
+    for (int i=1; i<TRANSITION_COUNT; i++)
+        debugf(" %s=%lu", phases[i], (unsigned long)TICKS_TO_US(t[i] - t[i-1]));
+    debugf(" total=%lu\n", (unsigned long)TICKS_TO_US(t[TRANSITION_COUNT-1] - t[TRANSITION_START]));
+}
+
+
+/*==============================
+    core_framering_new
+    Allocates a frame ring
+    @param  The number of frames in flight
+    @param  The size of one slot in bytes
+    @param  The number of slots per frame
+    @return The frame ring
+==============================*/
+
+CoreFrameRing* core_framering_new(int buffers, size_t slotsize, int slotcount)
+{
+    assertf(buffers > 0 && slotcount > 0, "Invalid frame ring size\n");
+
+    CoreFrameRing* ring = malloc(sizeof(CoreFrameRing));
+    ring->buffers = buffers;
+    ring->slotsize = (slotsize + 15) & ~15; // Keep every slot DMA aligned
+    ring->slotcount = slotcount;
+    ring->data = malloc_uncached(ring->slotsize*slotcount*buffers);
+    return ring;
+}
+
+
+/*==============================
+    core_framering_get_at
+    Gets a slot for a specific buffer
+    @param  The frame ring
+    @param  The buffer index
+    @param  The slot index
+    @return The slot's memory
+==============================*/
+
+void* core_framering_get_at(CoreFrameRing* ring, int buffer, int slot)
+{
+    assertf(slot >= 0 && slot < ring->slotcount, "Frame ring slot %d out of range\n", slot);
+    return ring->data + (buffer*ring->slotcount + slot)*ring->slotsize;
+}
+
+
+/*==============================
+    core_framering_get_buffer
+    Gets the buffer index of the frame currently being
+    drawn
+    @param  The frame ring
+    @return The buffer index
+==============================*/
+
+int core_framering_get_buffer(CoreFrameRing* ring)
+{
+    return global_core_frame % ring->buffers;
+}
+
+
+/*==============================
+    core_framering_get
+    Gets a slot for the frame currently being drawn
+    @param  The frame ring
+    @param  The slot index
+    @return The slot's memory
+==============================*/
+
+void* core_framering_get(CoreFrameRing* ring, int slot)
+{
+    return core_framering_get_at(ring, core_framering_get_buffer(ring), slot);
+}
+
+
+/*==============================
+    core_framering_free
+    Frees a frame ring
+    @param  The frame ring
+==============================*/
+
+void core_framering_free(CoreFrameRing* ring)
+{
+    if (ring == NULL)
+        return;
+    free_uncached(ring->data);
+    free(ring);
+}
+
+
+/*==============================
+    core_framering_advance
+    Moves all frame rings on to the next buffer. Called
+    once per drawn frame.
+==============================*/
+
+void core_framering_advance()
+{
+    global_core_frame++;
+}
+
+
+/*==============================
+    core_staticlayer_new
+    Allocates a static layer
+    @param  The width in pixels
+    @param  The height in pixels
+    @param  Whether the depth should be kept too
+    @return The static layer
+==============================*/
+
+CoreStaticLayer* core_staticlayer_new(int width, int height, bool hasdepth)
+{
+    CoreStaticLayer* layer = malloc(sizeof(CoreStaticLayer));
+    layer->color = surface_alloc(FMT_RGBA16, width, height);
+    layer->depth = hasdepth ? surface_alloc(FMT_RGBA16, width, height) : (surface_t){0};
+    return layer;
+}
+
+
+/*==============================
+    core_staticlayer_bake_begin
+    Attaches the static layer for drawing the static
+    scene into it
+    @param  The static layer
+==============================*/
+
+void core_staticlayer_bake_begin(CoreStaticLayer* layer)
+{
+    rdpq_attach(&layer->color, layer->depth.buffer ? &layer->depth : NULL);
+}
+
+
+/*==============================
+    core_staticlayer_bake_end
+    Detaches the static layer once it's drawn
+    @param  The static layer
+==============================*/
+
+void core_staticlayer_bake_end(CoreStaticLayer* layer)
+{
+    (void)layer;
+    rdpq_detach_wait();
+}
+
+
+/*==============================
+    core_staticlayer_attach
+    Restores the static layer into the given buffers and
+    attaches them
+    @param  The static layer
+    @param  The color buffer to draw to
+    @param  The depth buffer to draw to, or NULL
+==============================*/
+
+void core_staticlayer_attach(CoreStaticLayer* layer, surface_t* color, surface_t* depth)
+{
+    assertf(surface_get_format(color) == FMT_RGBA16, "Static layers need a 16-bit display\n");
+    assertf(depth == NULL || layer->depth.buffer, "This static layer has no depth\n");
+
+    // Copy mode moves 4 pixels per cycle without touching TMEM filtering or blending, which
+    // is much cheaper than transforming and lighting the scene again. The depth buffer is
+    // just another 16-bit surface, so it's restored by attaching it as the color target.
+    if (depth != NULL) {
+        rdpq_attach(depth, NULL);
+        rdpq_set_mode_copy(false);
+        rdpq_tex_blit(&layer->depth, 0, 0, NULL);
+        rdpq_detach();
+    }
+
+    rdpq_attach(color, depth);
+    rdpq_set_mode_copy(false);
+    rdpq_tex_blit(&layer->color, 0, 0, NULL);
+}
+
+
+/*==============================
+    core_staticlayer_free
+    Frees a static layer
+    @param  The static layer
+==============================*/
+
+void core_staticlayer_free(CoreStaticLayer* layer)
+{
+    if (layer == NULL)
+        return;
+    surface_free(&layer->color);
+    if (layer->depth.buffer)
+        surface_free(&layer->depth);
+    free(layer);
+}
+
+
+/*==============================
+    core_fontpack_load
+    Loads a font pack
+    @param  The path to the font pack
+    @return The font pack
+==============================*/
+
+CoreFontPack* core_fontpack_load(const char* path)
+{
+    int size;
+    uint8_t* data = asset_load(path, &size);
+    FontPackHeader* header = (FontPackHeader*)data;
+    assertf(header->magic == FONTPACK_MAGIC, "%s is not a font pack\n", path);
+    assertf(((uintptr_t)data % 8) == 0, "Font pack %s is misaligned\n", path);
+
+    // The fonts are used in place, so they share the pack's buffer
+    uint32_t* offsets = (uint32_t*)(header + 1);
+    CoreFontPack* pack = malloc(sizeof(CoreFontPack) + header->count*sizeof(rdpq_font_t*));
+    pack->data = data;
+    pack->count = header->count;
+    for (int i=0; i<pack->count; i++)
+        pack->fonts[i] = rdpq_font_load_buf(data + offsets[i], offsets[i+1] - offsets[i]);
+    return pack;
+}
+
+
+/*==============================
+    core_fontpack_count
+    Gets the number of fonts in a font pack
+    @param  The font pack
+    @return The number of fonts
+==============================*/
+
+int core_fontpack_count(CoreFontPack* pack)
+{
+    return pack->count;
+}
+
+
+/*==============================
+    core_fontpack_get
+    Gets a font from a font pack
+    @param  The font pack
+    @param  The font index
+    @return The font
+==============================*/
+
+rdpq_font_t* core_fontpack_get(CoreFontPack* pack, int index)
+{
+    assertf(index >= 0 && index < pack->count, "Font %d is not in the pack\n", index);
+    return pack->fonts[index];
+}
+
+
+/*==============================
+    core_fontpack_free
+    Frees a font pack and all its fonts
+    @param  The font pack
+==============================*/
+
+void core_fontpack_free(CoreFontPack* pack)
+{
+    if (pack == NULL)
+        return;
+    for (int i=0; i<pack->count; i++)
+        rdpq_font_free(pack->fonts[i]);
+    free(pack->data);
+    free(pack);
+}
+
+
+/*==============================
+    core_trace_record
+    Appends an event to the trace ring, overwriting the
+    oldest one once full. Also called from interrupts.
+    @param  The event type
+    @param  The frame the event belongs to
+    @param  The event name, or NULL
+==============================*/
+
+#if TRACE_CAPTURE
+static void core_trace_record(CoreTraceType type, uint16_t frame, const char* name)
+{
+    if (global_core_tracedumping)
+        return;
+    disable_interrupts();
+    CoreTraceEvent* ev = &global_core_trace[global_core_tracecount++ % TRACE_EVENTS];
+    ev->time = get_ticks();
+    ev->type = type;
+    ev->frame = frame;
+    ev->name = name;
+    enable_interrupts();
+}
+
+// The RDP finishes a frame after the CPU has moved on, so the frame comes with the callback
+static void core_trace_rdpdone(void* arg)
+{
+    core_trace_record(TRACE_RDP_DONE, (uint16_t)(uintptr_t)arg, NULL);
+}
+
+static void core_trace_vblank()
+{
+    core_trace_record(TRACE_VBLANK, global_core_traceframe, NULL);
+}
+#endif
+
+
+/*==============================
+    core_trace_zone_begin
+    Starts a named CPU zone in the trace timeline
+    @param  The zone name
+==============================*/
+
+void core_trace_zone_begin(const char* name)
+{
+    #if TRACE_CAPTURE
+        core_trace_record(TRACE_ZONE_BEGIN, global_core_traceframe, name);
+    #else
+        (void)name;
+    #endif
+}
+
+
+/*==============================
+    core_trace_zone_end
+    Ends the innermost CPU zone in the trace timeline
+==============================*/
+
+void core_trace_zone_end()
+{
+    #if TRACE_CAPTURE
+        core_trace_record(TRACE_ZONE_END, global_core_traceframe, NULL);
+    #endif
+}
+
+
+/*==============================
+    core_trace_block_run
+    Runs a block, marking its submission in the trace
+    @param  The block to run
+    @param  The block name
+==============================*/
+
+void core_trace_block_run(rspq_block_t* block, const char* name)
+{
+    #if TRACE_CAPTURE
+        core_trace_record(TRACE_BLOCK, global_core_traceframe, name);
+    #else
+        (void)name;
+    #endif
+    rspq_block_run(block);
+}
+
+
+/*==============================
+    core_trace_init
+    Starts recording vertical blanks, if tracing is on
+==============================*/
+
+void core_trace_init()
+{
+    #if TRACE_CAPTURE
+        register_VI_handler(core_trace_vblank);
+    #endif
+}
+
+
+/*==============================
+    core_trace_frame_begin
+    Marks the start of a frame in the trace
+==============================*/
+
+void core_trace_frame_begin()
+{
+    #if TRACE_CAPTURE
+        global_core_traceframe++;
+        core_trace_record(TRACE_FRAME_BEGIN, global_core_traceframe, NULL);
+    #endif
+}
+
+
+/*==============================
+    core_trace_frame_end
+    Marks the end of a frame in the trace, and asks the
+    RDP to report when it's done with it. The full sync
+    this needs is only queued when tracing is on.
+==============================*/
+
+void core_trace_frame_end()
+{
+    #if TRACE_CAPTURE
+        core_trace_record(TRACE_FRAME_END, global_core_traceframe, NULL);
+        rdpq_sync_full(core_trace_rdpdone, (void*)(uintptr_t)global_core_traceframe);
+    #endif
+}
+
+
+/*==============================
+    core_trace_dump
+    Writes the trace ring to the debug log, oldest event
+    first, then clears it. The line format is parsed by
+    tools/trace-convert, so keep them in sync.
+    @param  The internal name of the minigame
+==============================*/
+
+void core_trace_dump(const char* game)
+{
+    #if TRACE_CAPTURE
+        static const char* types[] = {"B", "E", "K", "F", "S", "R", "V"};
+
+        // Let the last frame's RDP callback land before reading the ring
+        rspq_wait();
+        global_core_tracedumping = true;
+        uint32_t count = global_core_tracecount;
+        uint32_t first = count > TRACE_EVENTS ? count - TRACE_EVENTS : 0;
+
+        debugf("[trace] begin %s %lu\n", game, (unsigned long)TICKS_PER_SECOND);
+        for (uint32_t i=first; i<count; i++)
+        {
+            CoreTraceEvent* ev = &global_core_trace[i % TRACE_EVENTS];
+            debugf("[trace] %08lx %s %u %s\n", (unsigned long)ev->time, types[ev->type], ev->frame, ev->name ? ev->name : "-");
+        }
+        debugf("[trace] end\n");
+        global_core_tracecount = 0;
+        global_core_tracedumping = false;
+    #else
+        (void)game;
+    #endif
 }
\ No newline at end of file
@@ -30,6 +30,28 @@ extern "C" {
         DIFF_HARD = 2,
     } AiDiff;
 
+    // Fixed tick counters since the minigame started, see core_get_tickstats
+    typedef struct {
+        uint32_t ticks;         // Ticks run
+        uint32_t dropped;       // Ticks skipped to catch up, which slows the game down
+        uint32_t worsttick_us;  // Slowest tick
+        uint64_t total_us;      // Time spent in all ticks
+    } CoreTickStats;
+
+    // N-buffered per-frame allocations, see core_framering_new
+    typedef struct CoreFrameRing CoreFrameRing;
+
+    // One typeface at several sizes in a single asset, see core_fontpack_load
+    typedef struct CoreFontPack CoreFontPack;
+
+    // Pre-rendered static scene, see core_staticlayer_new
+    typedef struct CoreStaticLayer CoreStaticLayer;
+
+    // Random number stream (xoshiro128**), see core_rng_get
+    typedef struct {
+        uint32_t s[4];
+    } CoreRng;
+
 
     /***************************************************************
                          Public Core Functions
@@ -68,6 +90,24 @@ extern "C" {
     ==============================*/
     double core_get_subtick();
 
+    /*==============================
+        core_set_maxcatchup
+        Sets how many fixed ticks can run in a single frame
+        to catch up after a slow one. If the game falls
+        further behind, the extra ticks are dropped and time
+        slows down instead. Reset to TICK_MAXCATCHUP for
+        every minigame.
+        @param  The maximum number of ticks per frame
+    ==============================*/
+    void core_set_maxcatchup(int ticks);
+
+    /*==============================
+        core_get_tickstats
+        Gets counters about the fixed ticks run so far
+        @return The tick counters
+    ==============================*/
+    CoreTickStats core_get_tickstats();
+
     /*==============================
         core_set_winner
         Set the winner of the minigame. You can call this
@@ -76,6 +116,272 @@ extern "C" {
     ==============================*/
     void core_set_winner(PlyNum ply);
 
+    /*==============================
+        core_display_init
+        Use this instead of display_init, and don't call
+        display_close. The display stays alive between the
+        menu and minigames, and is only reinitialized when
+        the requested mode differs from the current one,
+        which saves reallocating the framebuffers and the
+        z-buffer on every transition. The mode declared in
+        your MinigameDef is already set up before
+        minigame_init, so you only need this to switch
+        modes while your game runs.
+        @param  The resolution
+        @param  The color depth
+        @param  The number of framebuffers
+        @param  The gamma correction
+        @param  The VI filters
+    ==============================*/
+    void core_display_init(resolution_t res, bitdepth_t depth, uint32_t buffers, gamma_t gamma, filter_options_t filters);
+
+    /*==============================
+        core_t3d_acquire
+        Use this instead of t3d_init. Tiny3D is owned by the
+        core and stays loaded after the last release, so
+        consecutive Tiny3D minigames don't reload the RSP
+        overlay. State such as lights and draw flags carries
+        over from the last user, so set what you rely on.
+    ==============================*/
+    void core_t3d_acquire();
+
+    /*==============================
+        core_t3d_release
+        Use this instead of t3d_destroy. Every acquire must
+        be matched by a release.
+    ==============================*/
+    void core_t3d_release();
+
+    /*==============================
+        core_framering_new
+        Allocates uncached memory for data the RSP reads
+        every frame, such as matrices. Every frame gets its
+        own copy of each slot, so the CPU can fill in the
+        next frame while the RSP still reads the previous
+        ones, without waiting on a syncpoint.
+        Use the same buffer count as your core_display_init.
+        @param  The number of frames in flight
+        @param  The size of one slot in bytes
+        @param  The number of slots per frame
+        @return The frame ring
+    ==============================*/
+    CoreFrameRing* core_framering_new(int buffers, size_t slotsize, int slotcount);
+
+    /*==============================
+        core_framering_get
+        Gets a slot for the frame currently being drawn
+        @param  The frame ring
+        @param  The slot index
+        @return The slot's memory
+    ==============================*/
+    void* core_framering_get(CoreFrameRing* ring, int slot);
+
+    /*==============================
+        core_framering_get_at
+        Gets a slot for a specific buffer, for example to
+        record one rspq block per buffer
+        @param  The frame ring
+        @param  The buffer index
+        @param  The slot index
+        @return The slot's memory
+    ==============================*/
+    void* core_framering_get_at(CoreFrameRing* ring, int buffer, int slot);
+
+    /*==============================
+        core_framering_get_buffer
+        Gets the buffer index of the frame currently being
+        drawn
+        @param  The frame ring
+        @return The buffer index
+    ==============================*/
+    int core_framering_get_buffer(CoreFrameRing* ring);
+
+    /*==============================
+        core_framering_free
+        Frees a frame ring. Make sure the RSP is done with
+        it first (e.g. rspq_wait).
+        @param  The frame ring
+    ==============================*/
+    void core_framering_free(CoreFrameRing* ring);
+
+    /*==============================
+        core_staticlayer_new
+        Allocates a static layer, which holds the color and
+        depth of an opaque scene that never changes, such as
+        the level seen from a fixed camera. Render it once
+        between core_staticlayer_bake_begin and
+        core_staticlayer_bake_end, then start every frame
+        with core_staticlayer_attach instead of clearing and
+        redrawing it.
+        Only 16-bit displays are supported.
+        @param  The width in pixels
+        @param  The height in pixels
+        @param  Whether the depth should be kept too, for
+                scenes that are drawn with a z-buffer
+        @return The static layer
+    ==============================*/
+    CoreStaticLayer* core_staticlayer_new(int width, int height, bool hasdepth);
+
+    /*==============================
+        core_staticlayer_bake_begin
+        Attaches the static layer's own color and depth
+        buffers, so the static scene can be drawn into them
+        like into a regular frame
+        @param  The static layer
+    ==============================*/
+    void core_staticlayer_bake_begin(CoreStaticLayer* layer);
+
+    /*==============================
+        core_staticlayer_bake_end
+        Detaches the static layer and waits for the RDP to
+        finish drawing it. Anything the static scene needed
+        can be freed afterwards.
+        @param  The static layer
+    ==============================*/
+    void core_staticlayer_bake_end(CoreStaticLayer* layer);
+
+    /*==============================
+        core_staticlayer_attach
+        Use this in place of rdpq_attach and the screen
+        clears. Copies the baked color and depth into the
+        given buffers and leaves them attached, so dynamic
+        objects can be drawn on top.
+        @param  The static layer
+        @param  The color buffer to draw to
+        @param  The depth buffer to draw to, or NULL
+    ==============================*/
+    void core_staticlayer_attach(CoreStaticLayer* layer, surface_t* color, surface_t* depth);
+
+    /*==============================
+        core_staticlayer_free
+        Frees a static layer. Make sure the RDP is done with
+        it first (e.g. rspq_wait).
+        @param  The static layer
+    ==============================*/
+    void core_staticlayer_free(CoreStaticLayer* layer);
+
+    /*==============================
+        core_fontpack_load
+        Loads a font pack built by tools/mkfontpack. All the
+        sizes come from one file read into one allocation,
+        instead of one font64 file per size.
+        @param  The path to the font pack
+        @return The font pack
+    ==============================*/
+    CoreFontPack* core_fontpack_load(const char* path);
+
+    /*==============================
+        core_fontpack_count
+        Gets the number of fonts in a font pack
+        @param  The font pack
+        @return The number of fonts
+    ==============================*/
+    int core_fontpack_count(CoreFontPack* pack);
+
+    /*==============================
+        core_fontpack_get
+        Gets a font from a font pack, to style and register
+        like any other font. It's only valid until the pack
+        is freed.
+        @param  The font pack
+        @param  The font index, in the order the pack was
+                built with
+        @return The font
+    ==============================*/
+    rdpq_font_t* core_fontpack_get(CoreFontPack* pack, int index);
+
+    /*==============================
+        core_fontpack_free
+        Frees a font pack and all its fonts. Unregister
+        them first.
+        @param  The font pack
+    ==============================*/
+    void core_fontpack_free(CoreFontPack* pack);
+
+    /*==============================
+        core_trace_zone_begin
+        Starts a named CPU zone in the trace timeline, see
+        TRACE_CAPTURE in config.h. Zones can nest. Does
+        nothing when tracing is disabled.
+        @param  The zone name, which must be a string
+                literal as it's only read when the trace
+                is dumped
+    ==============================*/
+    void core_trace_zone_begin(const char* name);
+
+    /*==============================
+        core_trace_zone_end
+        Ends the innermost CPU zone in the trace timeline
+    ==============================*/
+    void core_trace_zone_end();
+
+    /*==============================
+        core_trace_block_run
+        Runs a block, marking its submission in the trace
+        timeline. Use it like rspq_block_run.
+        @param  The block to run
+        @param  The block name, a string literal
+    ==============================*/
+    void core_trace_block_run(rspq_block_t* block, const char* name);
+
+    /*==============================
+        core_rng_get
+        Gets a named random number stream. All streams are
+        reseeded when a minigame starts, and a given name
+        always produces the same sequence for the same seed,
+        so give every subsystem its own stream instead of
+        sharing rand().
+        @param  The name of the stream
+        @return The random number stream
+    ==============================*/
+    CoreRng* core_rng_get(const char* name);
+
+    /*==============================
+        core_rng_next
+        Gets the next random number from a stream
+        @param  The random number stream
+        @return 32 random bits
+    ==============================*/
+    static inline uint32_t core_rng_next(CoreRng* rng)
+    {
+        uint32_t* s = rng->s;
+        uint32_t x = s[1] * 5;
+        uint32_t result = ((x << 7) | (x >> 25)) * 9;
+        uint32_t t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = (s[3] << 11) | (s[3] >> 21);
+        return result;
+    }
+
+    /*==============================
+        core_rng_float
+        Gets a random float from a stream
+        @param  The random number stream
+        @return A random number from 0.0f (inclusive)
+                to 1.0f (exclusive)
+    ==============================*/
+    static inline float core_rng_float(CoreRng* rng)
+    {
+        return (core_rng_next(rng) >> 8) * (1.0f/16777216.0f);
+    }
+
+    /*==============================
+        core_rng_range
+        Gets a random integer from a stream
+        @param  The random number stream
+        @param  The minimum value (inclusive)
+        @param  The maximum value (inclusive)
+        @return The random integer
+    ==============================*/
+    static inline int core_rng_range(CoreRng* rng, int min, int max)
+    {
+        return min + (int)(((uint64_t)core_rng_next(rng) * (uint32_t)(max - min + 1)) >> 32);
+    }
+
     
     /***************************************************************
                         Internal Core Functions
@@ -85,12 +391,58 @@ extern "C" {
     #define TICKRATE   30
     #define DELTATIME  (1.0f/(double)TICKRATE)
 
+    #define TICK_MAXCATCHUP  4
+
+    #define WARMUP_SLICE_US  12000
+
     #define MAXPLAYERS  4
 
     void core_set_playercount(uint32_t playercount);
     void core_set_aidifficulty(AiDiff difficulty);
     void core_set_subtick(double subtick);
+    void core_set_tickrate(uint32_t tickrate);
+    void core_tick_reset();
+    void core_tick_run(void (*fixedloop)(float deltatime), float frametime);
+    void core_warmup_run(bool (*warmup)(int step));
     void core_reset_winners();
+    void core_framering_advance();
+    void core_rng_seed(uint32_t seed);
+    uint32_t core_rng_get_seed();
+
+    // Points timed on the way from the menu to a minigame's first frame
+    typedef enum {
+        TRANSITION_START,       // Minigame picked in the menu
+        TRANSITION_MENUDONE,    // Menu torn down
+        TRANSITION_LOADED,      // Minigame DSO loaded
+        TRANSITION_INITDONE,    // minigame_init returned
+        TRANSITION_WARMUPDONE,  // minigame_warmup finished
+        TRANSITION_FIRSTFRAME,  // First minigame_loop returned
+        TRANSITION_COUNT
+    } CoreTransitionMark;
+
+    void core_transition_mark(CoreTransitionMark mark);
+    void core_transition_report(const char* game);
+
+    void core_trace_init();
+    void core_trace_frame_begin();
+    void core_trace_frame_end();
+    void core_trace_dump(const char* game);
+
+    // Derives a stream's state from the session seed and its name
+    static inline void core_rng_init(CoreRng* rng, uint32_t seed, const char* name)
+    {
+        uint32_t h = 2166136261u;
+        while (*name)
+            h = (h ^ (uint8_t)*name++) * 16777619u;
+        h ^= seed;
+        for (int i=0; i<4; i++)
+        {
+            uint32_t z = (h += 0x9E3779B9u);
+            z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+            z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+            rng->s[i] = z ^ (z >> 16);
+        }
+    }
 
 #ifdef __cplusplus
 }
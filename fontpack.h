@@ -0,0 +1,21 @@
+#ifndef GAMEJAM2024_FONTPACK_H
+#define GAMEJAM2024_FONTPACK_H
+
+    #include <stdint.h>
+
+    // One typeface at several sizes in a single asset, built by tools/mkfontpack
+    // and loaded with core_fontpack_load. Everything is stored big-endian.
+    //
+    // File: FontPackHeader, then uint32_t offsets[count + 1] from the start of
+    //       the file (font i spans offsets[i] to offsets[i+1]), then each size
+    //       as an uncompressed font64, starting on a FONTPACK_ALIGN boundary.
+
+    #define FONTPACK_MAGIC  0x4650414B  // "FPAK"
+    #define FONTPACK_ALIGN  16
+
+    typedef struct {
+        uint32_t magic;
+        uint32_t count;
+    } FontPackHeader;
+
+#endif
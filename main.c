@@ -35,9 +35,10 @@ int main()
     joypad_init();
     timer_init();
     rdpq_init();
+    core_trace_init();
     minigame_loadall();
     audio_init(32000, 3);
-    mixer_init(32);
+    mixer_init(32);  // Minigames can ask for a different count in their MinigameDef
 
     // Enable RDP debugging
     #if DEBUG_RDP
@@ -46,34 +47,45 @@ int main()
         rspq_profile_start();
     #endif
 
-    // Initialize the random number generator, then call rand() every
-    // frame so to get random behavior also in emulators.
-    uint32_t seed;
-    getentropy(&seed, sizeof(seed));
-    srand(seed);
-    register_VI_handler((void(*)(void))rand);
-
     // Program Loop
     while (1)
     {
         char* game;
-        float accumulator = 0;
-        const float dt = DELTATIME;
+        bool firstframe = true;
 
         // Show the menu
         game = menu();
         
         // Set the initial minigame
         minigame_play(game);
+        core_transition_mark(TRANSITION_LOADED);
+
+        // Every minigame gets freshly seeded random number streams
+        uint32_t seed = RNG_SEED;
+        if (seed == 0)
+            getentropy(&seed, sizeof(seed));
+        core_rng_seed(seed);
+        debugf("Random seed: 0x%08lx\n", (unsigned long)seed);
 
         // Initialize the minigame
         core_reset_winners();
+        core_tick_reset();
+        core_trace_zone_begin("init");
         minigame_get_game()->funcPointer_init();
+        core_trace_zone_end();
+        core_transition_mark(TRANSITION_INITDONE);
+        if (minigame_get_game()->funcPointer_warmup) {
+            core_trace_zone_begin("warmup");
+            core_warmup_run(minigame_get_game()->funcPointer_warmup);
+            core_trace_zone_end();
+        }
+        core_transition_mark(TRANSITION_WARMUPDONE);
         
         // Handle the engine loop
         while (!minigame_get_ended())
         {
             float frametime = display_get_delta_time();
+            core_trace_frame_begin();
             
             // In order to prevent problems if the game slows down significantly, we will clamp the maximum timestep the simulation can take
             if (frametime > 0.25f)
@@ -81,12 +93,9 @@ int main()
             
             // Perform the update in discrete steps (ticks)
             if (minigame_get_game()->funcPointer_fixedloop) {
-                accumulator += frametime;
-                while (accumulator >= dt)
-                {
-                    minigame_get_game()->funcPointer_fixedloop(dt);
-                    accumulator -= dt;
-                }
+                core_trace_zone_begin("fixedloop");
+                core_tick_run(minigame_get_game()->funcPointer_fixedloop, frametime);
+                core_trace_zone_end();
             }
 
             // Read controler data
@@ -94,13 +103,30 @@ int main()
             mixer_try_play();
             
             // Perform the unfixed loop
-            core_set_subtick(((double)accumulator)/((double)dt));
+            core_framering_advance();
+            core_trace_zone_begin("loop");
             minigame_get_game()->funcPointer_loop(frametime);
+            core_trace_zone_end();
+            core_trace_frame_end();
+
+            // Log how long it took to get here from the menu
+            if (firstframe) {
+                core_transition_mark(TRANSITION_FIRSTFRAME);
+                core_transition_report(game);
+                firstframe = false;
+            }
         }
         
         // End the current level
+        if (minigame_get_game()->funcPointer_fixedloop) {
+            CoreTickStats ticks = core_get_tickstats();
+            debugf("[ticks] %s ran=%lu dropped=%lu worst=%luus average=%luus\n", game,
+                (unsigned long)ticks.ticks, (unsigned long)ticks.dropped, (unsigned long)ticks.worsttick_us,
+                (unsigned long)(ticks.ticks ? ticks.total_us/ticks.ticks : 0));
+        }
         rspq_wait();
-        for (int i=0; i<32; i++)
+        core_trace_dump(game);
+        for (uint32_t i=0; i<minigame_get_game()->definition.audiochannels; i++)
             mixer_ch_stop(i);
         minigame_get_game()->funcPointer_cleanup();
         minigame_cleanup();
@@ -18,6 +18,8 @@ This file contains the code for the basic menu
 #define FONT_TEXT       1
 #define FONT_DEBUG      2
 
+#define LIST_X          80
+
 typedef enum
 {
     SCREEN_PLAYERCOUNT,
@@ -94,6 +96,10 @@ static int item_count;              // The number of selection items in the curr
 static const char *heading;         // The heading of the menu screen
 static int select;                  // The currently selected item
 
+static rspq_block_t *list_block;    // Heading and items of the current screen
+static rspq_block_t *desc_block;    // Description of the selected minigame
+static int desc_select;             // The minigame desc_block was recorded for
+
 /*==============================
     set_menu_screen
     Switches the menu to another screen
@@ -125,6 +131,77 @@ void set_menu_screen(menu_screen screen)
         heading = "Pick a game!\n";
         break;
     }
+
+    // The blocks might still be in use by the RDP
+    rspq_wait();
+    if (list_block) rspq_block_free(list_block);
+    if (desc_block) rspq_block_free(desc_block);
+    list_block = NULL;
+    desc_block = NULL;
+}
+
+/*==============================
+    record_item_list
+    Records the heading and items of the current screen,
+    which only change along with the screen
+    @param  The y position of the heading
+    @param  The minigame indices, sorted by name
+    @param  Filled with the y position of every item
+    @return The recorded block
+==============================*/
+
+static rspq_block_t *record_item_list(int y0, int *sorted_indices, int *item_ypos)
+{
+    rdpq_textparms_t textparms = {
+        .width = 200, .tabstops = (int16_t[]){ 15 },
+    };
+
+    rspq_block_begin();
+    rdpq_set_mode_standard();
+
+    int ycur = y0;
+    ycur += rdpq_text_print(&textparms, FONT_TEXT, LIST_X-20, ycur, heading).advance_y;
+    ycur += 4;
+
+    for (int i = 0; i < item_count; i++) {
+        item_ypos[i] = ycur;
+
+        switch (current_screen) {
+        case SCREEN_PLAYERCOUNT:
+            ycur += rdpq_text_printf(&textparms, FONT_TEXT, LIST_X, ycur, "%d\n", i+1).advance_y;
+            break;
+        case SCREEN_AIDIFFICULTY:
+            ycur += rdpq_text_printf(&textparms, FONT_TEXT, LIST_X, ycur, "%s\n", get_difficulty_name(i)).advance_y;
+            break;
+        case SCREEN_MINIGAME:
+            ycur += rdpq_text_printf(&textparms, FONT_TEXT, LIST_X, ycur, "%d.\t%s\n", i+1, global_minigame_list[sorted_indices[i]].definition.gamename).advance_y;
+            break;
+        }
+    }
+    return rspq_block_end();
+}
+
+/*==============================
+    record_description
+    Records the word wrapped description and instructions
+    of a minigame, so they're only laid out once
+    @param  The minigame
+    @return The recorded block
+==============================*/
+
+static rspq_block_t *record_description(Minigame *cur)
+{
+    rdpq_textparms_t parms = {
+        .width = 300, .wrap = WRAP_WORD,
+    };
+
+    rspq_block_begin();
+    rdpq_set_mode_standard();
+
+    int y0 = 180;
+    y0 += rdpq_text_printf(&parms, FONT_TEXT, 10, y0, "%s\n\n", cur->definition.description).advance_y;
+    y0 += rdpq_text_printf(&parms, FONT_TEXT, 10, y0, "%s\n", cur->definition.instructions).advance_y;
+    return rspq_block_end();
 }
 
 /*==============================
@@ -145,11 +222,8 @@ char* menu(void)
     heap_stats_t heap_stats;
     sys_get_heap_stats(&heap_stats);
 
-    display_init(RESOLUTION_320x240, DEPTH_16_BPP, 3, GAMMA_NONE, FILTERS_RESAMPLE);
+    core_display_init(RESOLUTION_320x240, DEPTH_16_BPP, 3, GAMMA_NONE, FILTERS_RESAMPLE);
 
-    sprite_t *logo = sprite_load("rom:/n64brew.ia8.sprite");
-    sprite_t *jam = sprite_load("rom:/jam.rgba32.sprite");
-    
     rdpq_font_t *font = rdpq_font_load("rom:/squarewave.font64");
     rdpq_text_register_font(FONT_TEXT, font);
     rdpq_font_style(font, 0, &(rdpq_fontstyle_t){.color = MAYA_BLUE, .outline_color = GUN_METAL });
@@ -157,6 +231,37 @@ char* menu(void)
     rdpq_font_t *fontdbg = rdpq_font_load_builtin(FONT_BUILTIN_DEBUG_VAR);
     rdpq_text_register_font(FONT_DEBUG, fontdbg);
 
+    // The backdrop never changes while the menu is up, so it's drawn once and copied
+    // back every frame, and the sprites aren't needed afterwards
+    sprite_t *logo = sprite_load("rom:/n64brew.ia8.sprite");
+    sprite_t *jam = sprite_load("rom:/jam.rgba32.sprite");
+    const int list_y = 20 + logo->height + 20;
+
+    CoreStaticLayer *backdrop = core_staticlayer_new(display_get_width(), display_get_height(), false);
+    core_staticlayer_bake_begin(backdrop);
+        rdpq_clear(ASH_GRAY);
+
+        rdpq_set_mode_standard();
+        rdpq_mode_blender(RDPQ_BLENDER_MULTIPLY);
+        rdpq_mode_combiner(RDPQ_COMBINER1((PRIM,ENV,TEX0,ENV), (0,0,0,TEX0)));
+        rdpq_set_prim_color(BREWFONT);  // fill color
+        rdpq_set_env_color(BLACK);      // outline color
+        rdpq_sprite_blit(logo, 35, 20, NULL);
+
+        rdpq_set_mode_standard();
+        rdpq_mode_blender(RDPQ_BLENDER_MULTIPLY);
+        rdpq_sprite_blit(jam, 35+190, 10, NULL);
+
+        if (true) {
+            rdpq_set_mode_standard();
+            rdpq_text_printf(NULL, FONT_DEBUG, 10, 15, 
+                "Mem: %d KiB", heap_stats.used/1024);
+        }
+    core_staticlayer_bake_end(backdrop);
+
+    sprite_free(jam);
+    sprite_free(logo);
+
     max_playercount = 0;
     for (int i = 0; i < MAXPLAYERS; i++) {
         if (joypad_is_connected(i)) max_playercount++;
@@ -169,6 +274,7 @@ char* menu(void)
     float yselect_target = -1;
 
     int sorted_indices[global_minigame_count];
+    int item_ypos[global_minigame_count > MAXPLAYERS ? global_minigame_count : MAXPLAYERS];
     for (int i = 0; i < global_minigame_count; i++) sorted_indices[i] = i;
     qsort(sorted_indices, global_minigame_count, sizeof(int), minigame_sort);
 
@@ -193,6 +299,8 @@ char* menu(void)
     if (targetscreen == SCREEN_MINIGAME && SKIP_MINIGAMESELECTION)
         menu_done = true;
     set_menu_screen(targetscreen);
+    if (menu_done)
+        core_transition_mark(TRANSITION_START);
 
     while (!menu_done) {
         joypad_poll();
@@ -249,29 +357,25 @@ char* menu(void)
                     break;
             }
         }
+        if (menu_done)
+            core_transition_mark(TRANSITION_START);
+
+        // Only the text that changed is laid out again
+        if (!list_block)
+            list_block = record_item_list(list_y, sorted_indices, item_ypos);
+        if (current_screen == SCREEN_MINIGAME && (!desc_block || desc_select != select)) {
+            if (desc_block) {
+                rspq_wait();
+                rspq_block_free(desc_block);
+            }
+            desc_block = record_description(&global_minigame_list[sorted_indices[select]]);
+            desc_select = select;
+        }
+        yselect_target = (select >= 0 && select < item_count) ? item_ypos[select] : -1;
 
         surface_t *disp = display_get();
 
-        rdpq_attach(disp, NULL);
-        rdpq_clear(ASH_GRAY);
-
-        rdpq_textparms_t textparms = {
-            .width = 200, .tabstops = (int16_t[]){ 15 },
-        };
-
-        rdpq_set_mode_standard();
-        rdpq_mode_blender(RDPQ_BLENDER_MULTIPLY);
-        rdpq_mode_combiner(RDPQ_COMBINER1((PRIM,ENV,TEX0,ENV), (0,0,0,TEX0)));
-        rdpq_set_prim_color(BREWFONT);  // fill color
-        rdpq_set_env_color(BLACK);      // outline color
-        rdpq_sprite_blit(logo, 35, 20, NULL);
-
-        rdpq_set_mode_standard();
-        rdpq_mode_blender(RDPQ_BLENDER_MULTIPLY);
-        rdpq_sprite_blit(jam, 35+190, 10, NULL);
-
-        int x0 = 80;
-        int y0 = 20 + logo->height + 20;
+        core_staticlayer_attach(backdrop, disp, NULL);
 
         if (yselect_target >= 0) {
             if (yselect < 0) yselect = yselect_target;
@@ -279,63 +383,31 @@ char* menu(void)
             rdpq_set_mode_standard();
             rdpq_mode_combiner(RDPQ_COMBINER_FLAT);
             rdpq_set_prim_color(REDWOOD);
-            rdpq_fill_rectangle(x0-10, yselect-12, x0+150, yselect+5);
+            rdpq_fill_rectangle(LIST_X-10, yselect-12, LIST_X+150, yselect+5);
         }
 
-        rdpq_set_mode_standard();
-
-        int ycur = y0;
-        ycur += rdpq_text_print(&textparms, FONT_TEXT, x0-20, ycur, heading).advance_y;
-        ycur += 4;
-
-        for (int i = 0; i < item_count; i++) {
-            if (select == i) yselect_target = ycur;
-
-            switch (current_screen) {
-            case SCREEN_PLAYERCOUNT:
-                ycur += rdpq_text_printf(&textparms, FONT_TEXT, x0, ycur, "%d\n", i+1).advance_y;
-                break;
-            case SCREEN_AIDIFFICULTY:
-                ycur += rdpq_text_printf(&textparms, FONT_TEXT, x0, ycur, "%s\n", get_difficulty_name(i)).advance_y;
-                break;
-            case SCREEN_MINIGAME:
-                ycur += rdpq_text_printf(&textparms, FONT_TEXT, x0, ycur, "%d.\t%s\n", i+1, global_minigame_list[sorted_indices[i]].definition.gamename).advance_y;
-                break;
-            }
-        }
+        rspq_block_run(list_block);
+        if (current_screen == SCREEN_MINIGAME)
+            rspq_block_run(desc_block);
 
-        if (current_screen == SCREEN_MINIGAME) {
-            // Show the description of the selected minigame
-            rdpq_textparms_t parms = {
-                .width = 300, .wrap = WRAP_WORD,
-            };
-
-            Minigame *cur = &global_minigame_list[sorted_indices[select]];
-
-            int y0 = 180;
-            y0 += rdpq_text_printf(&parms, FONT_TEXT, 10, y0, "%s\n\n", cur->definition.description).advance_y;
-            y0 += rdpq_text_printf(&parms, FONT_TEXT, 10, y0, "%s\n", cur->definition.instructions).advance_y;
-        }
-
-        if (true) {
-            rdpq_text_printf(NULL, FONT_DEBUG, 10, 15, 
-                "Mem: %d KiB", heap_stats.used/1024);
-        }
         rdpq_detach_show();
     }
 
     is_first_time = false;
 
     rspq_wait();
-    sprite_free(jam);
-    sprite_free(logo);
+    if (list_block) rspq_block_free(list_block);
+    if (desc_block) rspq_block_free(desc_block);
+    list_block = NULL;
+    desc_block = NULL;
+    core_staticlayer_free(backdrop);
     rdpq_text_unregister_font(FONT_TEXT);
     rdpq_text_unregister_font(FONT_DEBUG);
     rdpq_font_free(font);
     rdpq_font_free(fontdbg);
-    display_close();
     core_set_playercount(playercount);
     core_set_aidifficulty(ai_difficulty);
+    core_transition_mark(TRANSITION_MENUDONE);
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Warray-bounds"
     return global_minigame_list[sorted_indices[selected_minigame]].internalname;
@@ -24,6 +24,14 @@ size_t    global_minigame_count;
 static const char*  global_minigamepath = "rom:/minigames/";
 static const size_t global_minigamepath_len = 15;
 
+// Settings for minigames that don't declare their own
+#define DEFAULT_BUFFERS        3
+#define DEFAULT_FILTERS        FILTERS_RESAMPLE
+#define DEFAULT_AUDIOCHANNELS  32
+
+// Number of mixer channels currently set up
+static uint32_t global_minigame_audiochannels = DEFAULT_AUDIOCHANNELS;
+
 
 /*==============================
     minigame_loadall
@@ -71,11 +79,30 @@ void minigame_loadall()
         // Since these symbols will only be temporarily stored in memory, we must make a deep copy
         loadeddef = dlsym(handle, "minigame_def");
         assertf(loadeddef, "Unable to find symbol minigame_def in %s\n", filename);
+        newdef->definition               = *loadeddef;
         newdef->definition.gamename      = strdup(loadeddef->gamename);
         newdef->definition.developername = strdup(loadeddef->developername);
         newdef->definition.description   = strdup(loadeddef->description);
         newdef->definition.instructions  = strdup(loadeddef->instructions);
 
+        // Fill in the settings that were left out, so they can be applied as they are
+        MinigameDef* def = &newdef->definition;
+        if (def->tickrate == 0)
+            def->tickrate = TICKRATE;
+        if (def->resolution.width == 0)
+        {
+            def->resolution = RESOLUTION_320x240;
+            def->depth = DEPTH_16_BPP;
+            def->buffers = DEFAULT_BUFFERS;
+            def->filters = DEFAULT_FILTERS;
+        }
+        if (def->depth == 0)
+            def->depth = DEPTH_16_BPP;
+        if (def->buffers == 0)
+            def->buffers = DEFAULT_BUFFERS;
+        if (def->audiochannels == 0)
+            def->audiochannels = DEFAULT_AUDIOCHANNELS;
+
         // Set the internal name as the filename without the extension
         strrchr(filename, '.')[0] = '\0';
         newdef->internalname = strdup(filename);
@@ -117,9 +144,21 @@ void minigame_play(char* name)
     global_minigame_current->handle = dlopen(fullpath, RTLD_LOCAL);
 
     global_minigame_current->funcPointer_init      = dlsym(global_minigame_current->handle, "minigame_init");
+    global_minigame_current->funcPointer_warmup    = dlsym(global_minigame_current->handle, "minigame_warmup");
     global_minigame_current->funcPointer_loop      = dlsym(global_minigame_current->handle, "minigame_loop");
     global_minigame_current->funcPointer_fixedloop = dlsym(global_minigame_current->handle, "minigame_fixedloop");
     global_minigame_current->funcPointer_cleanup   = dlsym(global_minigame_current->handle, "minigame_cleanup");
+
+    // Apply the minigame's settings
+    MinigameDef* def = &global_minigame_current->definition;
+    core_set_tickrate(def->tickrate);
+    core_display_init(def->resolution, def->depth, def->buffers, GAMMA_NONE, def->filters);
+    if (def->audiochannels != global_minigame_audiochannels)
+    {
+        mixer_close();
+        mixer_init(def->audiochannels);
+        global_minigame_audiochannels = def->audiochannels;
+    }
 }
 
 
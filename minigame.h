@@ -15,6 +15,14 @@ extern "C" {
         const char* developername;
         const char* description;
         const char* instructions;
+
+        // Optional settings, applied before minigame_init. Leave them out to get the defaults.
+        uint32_t tickrate;        // Fixed loop ticks per second, TICKRATE if 0
+        resolution_t resolution;  // The display settings are only used if this is set,
+        bitdepth_t depth;         // otherwise it's 320x240, 16-bit, 3 buffers and FILTERS_RESAMPLE.
+        uint32_t buffers;         // The depth and buffer count default to 16-bit and 3 if 0,
+        filter_options_t filters; // the filters are always used as given
+        uint32_t audiochannels;   // Mixer channels, 32 if 0
     } MinigameDef;
 
 
@@ -41,6 +49,7 @@ extern "C" {
         MinigameDef definition;
         void* handle;
         void (*funcPointer_init)(void);
+        bool (*funcPointer_warmup)(int step);
         void (*funcPointer_loop)(float deltatime);
         void (*funcPointer_fixedloop)(float deltatime);
         void (*funcPointer_cleanup)(void);
@@ -0,0 +1,106 @@
+/***************************************************************
+                         mkfontpack.c
+
+Packs several font64 files, usually one typeface converted at
+different sizes, into the single asset described in fontpack.h.
+The game then opens and reads one file instead of one per size,
+and all sizes live in one allocation. The font64 files must be
+uncompressed (mkfont -c 0); compress the pack as a whole.
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "fontpack.h"
+
+typedef struct {
+    uint8_t *data;
+    size_t size;
+} Blob;
+
+/*********************************
+             Helpers
+*********************************/
+
+static void put_u32(FILE *f, uint32_t v) {
+    uint8_t b[4] = { v >> 24, v >> 16, v >> 8, v };
+    fwrite(b, 1, 4, f);
+}
+
+static size_t align(size_t v) {
+    return (v + FONTPACK_ALIGN - 1) & ~(size_t)(FONTPACK_ALIGN - 1);
+}
+
+static int read_file(const char *path, Blob *blob) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return 0;
+    fseek(f, 0, SEEK_END);
+    blob->size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    blob->data = malloc(blob->size);
+    int ok = fread(blob->data, 1, blob->size, f) == blob->size;
+    fclose(f);
+    return ok;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "Usage: %s -o FILE FONT64...\n", name);
+}
+
+int main(int argc, char **argv) {
+    const char *output = NULL;
+    const char **inputs = calloc(argc, sizeof(char*));
+    int count = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc) output = argv[++i];
+        else if (argv[i][0] == '-') {
+            usage(argv[0]);
+            return 1;
+        }
+        else inputs[count++] = argv[i];
+    }
+
+    if (!output || count == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    Blob *blobs = calloc(count, sizeof(Blob));
+    for (int i = 0; i < count; i++) {
+        if (!read_file(inputs[i], &blobs[i])) {
+            fprintf(stderr, "Cannot read %s\n", inputs[i]);
+            return 1;
+        }
+    }
+
+    FILE *f = fopen(output, "wb");
+    if (!f) {
+        fprintf(stderr, "Cannot write %s\n", output);
+        return 1;
+    }
+
+    put_u32(f, FONTPACK_MAGIC);
+    put_u32(f, count);
+
+    size_t offset = align(sizeof(FontPackHeader) + (count + 1) * sizeof(uint32_t));
+    for (int i = 0; i < count; i++) {
+        put_u32(f, offset);
+        offset = align(offset + blobs[i].size);
+    }
+    put_u32(f, offset);
+
+    for (int i = 0; i < count; i++) {
+        while (ftell(f) % FONTPACK_ALIGN) fputc(0, f);
+        fwrite(blobs[i].data, 1, blobs[i].size, f);
+        free(blobs[i].data);
+    }
+    while (ftell(f) % FONTPACK_ALIGN) fputc(0, f);
+
+    fclose(f);
+    free(blobs);
+    free(inputs);
+    return 0;
+}
@@ -0,0 +1,229 @@
+/***************************************************************
+                           host.cpp
+
+Host-side definitions for the few libdragon, core and minigame
+symbols the paintball sources link against. Everything that the
+simulation reads is thread local, so every worker thread can run
+its own match without locks.
+***************************************************************/
+
+#include <libdragon.h>
+
+#include <atomic>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "../../../core.h"
+#include "../../../minigame.h"
+
+namespace {
+    thread_local uint32_t playerCount = 0;
+    thread_local AiDiff aiDifficulty = DIFF_MEDIUM;
+
+    struct RngStream {
+        std::string name;
+        CoreRng rng;
+    };
+    thread_local uint32_t rngSeed = 0;
+    // Deque, so pointers handed out stay valid as streams are added
+    thread_local std::deque<RngStream> rngStreams;
+
+    std::atomic<uint32_t> ticks {0};
+
+    surface_t screen {0, 320, 240, 640, nullptr};
+    surface_t zbuf {0, 320, 240, 640, nullptr};
+}
+
+/*********************************
+             libdragon
+*********************************/
+
+// Simulation code never depends on wall time, a monotonically increasing counter is enough
+uint32_t get_ticks(void)
+{
+    return ticks.fetch_add(1, std::memory_order_relaxed);
+}
+
+surface_t *display_get(void)
+{
+    return &screen;
+}
+
+surface_t *display_get_zbuf(void)
+{
+    return &zbuf;
+}
+
+/*********************************
+              Core
+*********************************/
+
+uint32_t core_get_playercount()
+{
+    return playerCount;
+}
+
+joypad_port_t core_get_playercontroller(PlyNum ply)
+{
+    return (joypad_port_t)ply;
+}
+
+AiDiff core_get_aidifficulty()
+{
+    return aiDifficulty;
+}
+
+double core_get_subtick()
+{
+    return 0;
+}
+
+void core_set_winner(PlyNum ply)
+{
+    (void)ply;
+}
+
+void core_set_playercount(uint32_t playercount)
+{
+    playerCount = playercount;
+}
+
+void core_set_aidifficulty(AiDiff difficulty)
+{
+    aiDifficulty = difficulty;
+}
+
+void core_set_subtick(double subtick)
+{
+    (void)subtick;
+}
+
+void core_reset_winners()
+{
+}
+
+void core_display_init(resolution_t res, bitdepth_t depth, uint32_t buffers, gamma_t gamma, filter_options_t filters)
+{
+    display_init(res, depth, buffers, gamma, filters);
+}
+
+void core_t3d_acquire()
+{
+}
+
+void core_t3d_release()
+{
+}
+
+void core_trace_zone_begin(const char* name)
+{
+    (void)name;
+}
+
+void core_trace_zone_end()
+{
+}
+
+void core_trace_block_run(rspq_block_t* block, const char* name)
+{
+    (void)name;
+    rspq_block_run(block);
+}
+
+// Nothing is drawn on the host, the fonts are placeholders
+struct CoreFontPack {
+    std::vector<rdpq_font_t> fonts;
+};
+
+CoreFontPack* core_fontpack_load(const char* path)
+{
+    (void)path;
+    return new CoreFontPack {std::vector<rdpq_font_t>(3)};
+}
+
+int core_fontpack_count(CoreFontPack* pack)
+{
+    return (int)pack->fonts.size();
+}
+
+rdpq_font_t* core_fontpack_get(CoreFontPack* pack, int index)
+{
+    return &pack->fonts[index];
+}
+
+void core_fontpack_free(CoreFontPack* pack)
+{
+    delete pack;
+}
+
+// Nothing is drawn on the host, a single buffer is enough
+struct CoreFrameRing {
+    size_t slotsize;
+    int slotcount;
+    std::vector<uint8_t> data;
+};
+
+CoreFrameRing* core_framering_new(int buffers, size_t slotsize, int slotcount)
+{
+    (void)buffers;
+    return new CoreFrameRing {slotsize, slotcount, std::vector<uint8_t>(slotsize * slotcount)};
+}
+
+void* core_framering_get_at(CoreFrameRing* ring, int buffer, int slot)
+{
+    (void)buffer;
+    return ring->data.data() + slot * ring->slotsize;
+}
+
+void* core_framering_get(CoreFrameRing* ring, int slot)
+{
+    return core_framering_get_at(ring, 0, slot);
+}
+
+int core_framering_get_buffer(CoreFrameRing* ring)
+{
+    (void)ring;
+    return 0;
+}
+
+void core_framering_free(CoreFrameRing* ring)
+{
+    delete ring;
+}
+
+void core_framering_advance()
+{
+}
+
+void core_rng_seed(uint32_t seed)
+{
+    rngSeed = seed;
+    rngStreams.clear();
+}
+
+uint32_t core_rng_get_seed()
+{
+    return rngSeed;
+}
+
+// Same derivation as core.c, so a seed reproduces the sequence seen on hardware
+CoreRng* core_rng_get(const char* name)
+{
+    for (auto &stream : rngStreams) {
+        if (stream.name == name) return &stream.rng;
+    }
+
+    RngStream &stream = rngStreams.emplace_back();
+    stream.name = name;
+    core_rng_init(&stream.rng, rngSeed, name);
+    return &stream.rng;
+}
+
+/*********************************
+            Minigame
+*********************************/
+
+void minigame_end()
+{
+}
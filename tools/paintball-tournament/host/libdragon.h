@@ -0,0 +1,304 @@
+/***************************************************************
+                          libdragon.h
+
+Host-side stand-in for the libdragon API surface used by the
+minigames. Every hardware call is a no-op; only the parts that
+influence simulation results (timers, math, memory) do real work.
+***************************************************************/
+
+#ifndef HOST_LIBDRAGON_H
+#define HOST_LIBDRAGON_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdarg.h>
+
+#ifdef __cplusplus
+#define HOST_INLINE inline
+#define HOST_LITERAL(T) T
+extern "C" {
+#else
+#define HOST_INLINE static inline
+#define HOST_LITERAL(T) (T)
+#endif
+
+/*********************************
+             System
+*********************************/
+
+#define debugf(...)             ((void)0)
+#define assertf(cond, ...)      do { if (!(cond)) { fprintf(stderr, "assertion failed: %s (%s:%d)\n", #cond, __FILE__, __LINE__); abort(); } } while (0)
+#define assert(cond)            assertf(cond, "")
+
+#define TICKS_PER_SECOND        46875000
+#define TICKS_FROM_MS(ms)       ((uint32_t)((ms) * (TICKS_PER_SECOND / 1000)))
+#define TICKS_FROM_US(us)       ((uint32_t)((us) * 8 * TICKS_PER_SECOND / 8000000))
+#define TICKS_TO_US(t)          ((uint32_t)((uint64_t)(t) * 1000000 / TICKS_PER_SECOND))
+#define TICKS_TO_MS(t)          ((uint32_t)((uint64_t)(t) * 1000 / TICKS_PER_SECOND))
+#define TICKS_DISTANCE(f, t)    ((int32_t)((uint32_t)(t) - (uint32_t)(f)))
+
+uint32_t get_ticks(void);
+
+typedef struct { int total; int used; } heap_stats_t;
+HOST_INLINE void sys_get_heap_stats(heap_stats_t *stats) { stats->total = 0; stats->used = 0; }
+
+HOST_INLINE void *malloc_uncached(size_t size) { return calloc(1, size); }
+HOST_INLINE void *malloc_uncached_aligned(int align, size_t size) { (void)align; return calloc(1, size); }
+HOST_INLINE void free_uncached(void *buf) { free(buf); }
+
+#define TF_ONE_SHOT     0
+#define TF_CONTINUOUS   1
+#define TF_DISABLED     2
+
+typedef struct timer_link_s { int dummy; } timer_link_t;
+typedef void (*timer_callback2_t)(int ovfl, void *ctx);
+HOST_INLINE timer_link_t *new_timer_context(int ticks, int flags, timer_callback2_t cb, void *ctx) { (void)ticks; (void)flags; (void)cb; (void)ctx; return (timer_link_t*)calloc(1, sizeof(timer_link_t)); }
+HOST_INLINE void delete_timer(timer_link_t *t) { free(t); }
+
+/*********************************
+         Colors & surfaces
+*********************************/
+
+typedef struct { uint8_t r, g, b, a; } color_t;
+#define RGBA32(rx, gx, bx, ax)  (HOST_LITERAL(color_t){(uint8_t)(rx), (uint8_t)(gx), (uint8_t)(bx), (uint8_t)(ax)})
+HOST_INLINE uint16_t color_to_packed16(color_t c) { return (uint16_t)(((c.r >> 3) << 11) | ((c.g >> 3) << 6) | ((c.b >> 3) << 1) | (c.a >> 7)); }
+HOST_INLINE uint32_t color_to_packed32(color_t c) { return ((uint32_t)c.r << 24) | ((uint32_t)c.g << 16) | ((uint32_t)c.b << 8) | c.a; }
+HOST_INLINE color_t color_from_packed32(uint32_t c) { color_t r = { (uint8_t)(c >> 24), (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c }; return r; }
+
+typedef enum { FMT_NONE, FMT_RGBA16, FMT_RGBA32, FMT_CI8, FMT_CI4, FMT_I8, FMT_IA8 } tex_format_t;
+
+typedef struct surface_s {
+    uint16_t flags;
+    uint16_t width;
+    uint16_t height;
+    uint16_t stride;
+    void *buffer;
+} surface_t;
+
+HOST_INLINE surface_t surface_alloc(tex_format_t format, uint16_t width, uint16_t height) { surface_t s = { (uint16_t)format, width, height, (uint16_t)(width * 2), calloc(width * height, 2) }; return s; }
+HOST_INLINE void surface_free(surface_t *s) { free(s->buffer); s->buffer = NULL; }
+HOST_INLINE surface_t surface_make_sub(surface_t *parent, uint32_t x0, uint32_t y0, uint32_t width, uint32_t height) { (void)x0; (void)y0; surface_t s = *parent; s.width = (uint16_t)width; s.height = (uint16_t)height; return s; }
+HOST_INLINE tex_format_t surface_get_format(const surface_t *s) { return (tex_format_t)s->flags; }
+
+typedef struct { uint16_t width; uint16_t height; uint8_t flags; uint8_t hslices; uint8_t vslices; } sprite_t;
+HOST_INLINE sprite_t *sprite_load(const char *fn) { (void)fn; sprite_t *s = (sprite_t*)calloc(1, sizeof(sprite_t)); s->width = 32; s->height = 32; return s; }
+HOST_INLINE void sprite_free(sprite_t *s) { free(s); }
+HOST_INLINE surface_t sprite_get_pixels(sprite_t *s) { surface_t r = { 0, s->width, s->height, 0, NULL }; return r; }
+
+/*********************************
+             Display
+*********************************/
+
+typedef struct { int32_t width; int32_t height; int interlaced; float aspect_ratio; } resolution_t;
+#define RESOLUTION_320x240  (HOST_LITERAL(resolution_t){320, 240, 0, 4.0f/3.0f})
+#define RESOLUTION_640x480  (HOST_LITERAL(resolution_t){640, 480, 1, 4.0f/3.0f})
+typedef enum { DEPTH_16_BPP, DEPTH_32_BPP } bitdepth_t;
+typedef enum { GAMMA_NONE, GAMMA_CORRECT, GAMMA_CORRECT_DITHER } gamma_t;
+typedef enum { FILTERS_DISABLED, FILTERS_RESAMPLE, FILTERS_DEDITHER, FILTERS_RESAMPLE_ANTIALIAS, FILTERS_RESAMPLE_ANTIALIAS_DEDITHER } filter_options_t;
+
+HOST_INLINE void display_init(resolution_t res, bitdepth_t bit, uint32_t num_buffers, gamma_t gamma, filter_options_t filters) { (void)res; (void)bit; (void)num_buffers; (void)gamma; (void)filters; }
+HOST_INLINE void display_close(void) {}
+surface_t *display_get(void);
+surface_t *display_get_zbuf(void);
+HOST_INLINE int display_get_width(void) { return 320; }
+HOST_INLINE int display_get_height(void) { return 240; }
+HOST_INLINE float display_get_delta_time(void) { return 1.0f / 60.0f; }
+HOST_INLINE float display_get_fps(void) { return 60.0f; }
+
+/*********************************
+               RSPQ
+*********************************/
+
+typedef struct rspq_block_s { int dummy; } rspq_block_t;
+typedef int rspq_syncpoint_t;
+HOST_INLINE void rspq_block_begin(void) {}
+HOST_INLINE rspq_block_t *rspq_block_end(void) { return (rspq_block_t*)calloc(1, sizeof(rspq_block_t)); }
+HOST_INLINE void rspq_block_run(rspq_block_t *block) { (void)block; }
+HOST_INLINE void rspq_block_free(rspq_block_t *block) { free(block); }
+HOST_INLINE void rspq_wait(void) {}
+HOST_INLINE void rspq_flush(void) {}
+HOST_INLINE rspq_syncpoint_t rspq_syncpoint_new(void) { return 1; }
+HOST_INLINE void rspq_syncpoint_wait(rspq_syncpoint_t sp) { (void)sp; }
+HOST_INLINE bool rspq_syncpoint_check(rspq_syncpoint_t sp) { (void)sp; return true; }
+HOST_INLINE void rspq_profile_start(void) {}
+
+/*********************************
+               RDPQ
+*********************************/
+
+typedef enum { TILE0, TILE1, TILE2, TILE3, TILE4, TILE5, TILE6, TILE7 } rdpq_tile_t;
+typedef enum { FILTER_POINT, FILTER_BILINEAR, FILTER_MEDIAN } rdpq_filter_t;
+typedef enum { TLUT_NONE, TLUT_RGBA16, TLUT_IA16 } rdpq_tlut_t;
+typedef enum { AA_NONE, AA_STANDARD, AA_REDUCED } rdpq_antialias_t;
+typedef uint64_t rdpq_combiner_t;
+typedef uint32_t rdpq_blender_t;
+
+#define RDPQ_COMBINER1(rgb, alpha)      ((rdpq_combiner_t)0)
+#define RDPQ_COMBINER2(rgb, a, rgb2, a2) ((rdpq_combiner_t)0)
+#define RDPQ_BLENDER(bl)                ((rdpq_blender_t)0)
+#define RDPQ_COMBINER_FLAT              ((rdpq_combiner_t)0)
+#define RDPQ_COMBINER_SHADE             ((rdpq_combiner_t)0)
+#define RDPQ_COMBINER_TEX               ((rdpq_combiner_t)0)
+#define RDPQ_COMBINER_TEX_SHADE         ((rdpq_combiner_t)0)
+#define RDPQ_BLENDER_MULTIPLY           ((rdpq_blender_t)0)
+#define RDPQ_BLENDER_MULTIPLY_CONST     ((rdpq_blender_t)0)
+#define RDPQ_BLENDER_ADDITIVE           ((rdpq_blender_t)0)
+#define SOM_COVERAGE_DEST_MASK          0
+#define SOM_COVERAGE_DEST_ZAP           0
+#define REPEAT_INFINITE                 2048
+
+HOST_INLINE void rdpq_init(void) {}
+HOST_INLINE void rdpq_attach(const surface_t *color, const surface_t *depth) { (void)color; (void)depth; }
+HOST_INLINE void rdpq_attach_clear(const surface_t *color, const surface_t *depth) { (void)color; (void)depth; }
+HOST_INLINE void rdpq_detach(void) {}
+HOST_INLINE void rdpq_detach_wait(void) {}
+HOST_INLINE void rdpq_detach_show(void) {}
+HOST_INLINE void rdpq_set_scissor(int x0, int y0, int x1, int y1) { (void)x0; (void)y0; (void)x1; (void)y1; }
+HOST_INLINE void rdpq_clear(color_t c) { (void)c; }
+HOST_INLINE void rdpq_clear_z(uint16_t z) { (void)z; }
+HOST_INLINE void rdpq_set_mode_standard(void) {}
+HOST_INLINE void rdpq_set_mode_copy(bool transparency) { (void)transparency; }
+HOST_INLINE void rdpq_set_mode_fill(color_t c) { (void)c; }
+HOST_INLINE void rdpq_mode_combiner(rdpq_combiner_t c) { (void)c; }
+HOST_INLINE void rdpq_mode_blender(rdpq_blender_t b) { (void)b; }
+HOST_INLINE void rdpq_mode_zbuf(bool compare, bool update) { (void)compare; (void)update; }
+HOST_INLINE void rdpq_mode_alphacompare(int threshold) { (void)threshold; }
+HOST_INLINE void rdpq_mode_filter(rdpq_filter_t f) { (void)f; }
+HOST_INLINE void rdpq_mode_tlut(rdpq_tlut_t t) { (void)t; }
+HOST_INLINE void rdpq_mode_persp(bool p) { (void)p; }
+HOST_INLINE void rdpq_mode_antialias(rdpq_antialias_t aa) { (void)aa; }
+HOST_INLINE void rdpq_mode_push(void) {}
+HOST_INLINE void rdpq_mode_pop(void) {}
+HOST_INLINE void rdpq_change_other_modes_raw(uint64_t mask, uint64_t val) { (void)mask; (void)val; }
+HOST_INLINE void rdpq_set_prim_color(color_t c) { (void)c; }
+HOST_INLINE void rdpq_set_env_color(color_t c) { (void)c; }
+HOST_INLINE void rdpq_set_fog_color(color_t c) { (void)c; }
+HOST_INLINE void rdpq_set_blend_color(color_t c) { (void)c; }
+HOST_INLINE void rdpq_sync_pipe(void) {}
+HOST_INLINE void rdpq_sync_tile(void) {}
+HOST_INLINE void rdpq_sync_load(void) {}
+HOST_INLINE void rdpq_sync_full(void (*cb)(void*), void *arg) { (void)cb; (void)arg; }
+HOST_INLINE void rdpq_fill_rectangle(float x0, float y0, float x1, float y1) { (void)x0; (void)y0; (void)x1; (void)y1; }
+HOST_INLINE void rdpq_texture_rectangle(rdpq_tile_t tile, float x0, float y0, float x1, float y1, float s, float t) { (void)tile; (void)x0; (void)y0; (void)x1; (void)y1; (void)s; (void)t; }
+
+typedef struct {
+    rdpq_tile_t tile;
+    int s0;
+    int t0;
+    int width;
+    int height;
+    bool flip_x;
+    bool flip_y;
+    int cx;
+    int cy;
+    float scale_x;
+    float scale_y;
+    float theta;
+    bool filtering;
+    int nx;
+    int ny;
+} rdpq_blitparms_t;
+
+typedef struct { struct { float translate; float scale_log; int repeats; bool mirror; } s, t; } rdpq_texparms_t;
+
+HOST_INLINE void rdpq_tex_blit(const surface_t *s, float x0, float y0, const rdpq_blitparms_t *parms) { (void)s; (void)x0; (void)y0; (void)parms; }
+HOST_INLINE void rdpq_sprite_blit(sprite_t *s, float x0, float y0, const rdpq_blitparms_t *parms) { (void)s; (void)x0; (void)y0; (void)parms; }
+HOST_INLINE int rdpq_tex_upload_sub(rdpq_tile_t tile, const surface_t *tex, const void *parms, int s0, int t0, int s1, int t1) { (void)tile; (void)tex; (void)parms; (void)s0; (void)t0; (void)s1; (void)t1; return 0; }
+HOST_INLINE void rdpq_tex_upload_tlut(uint16_t *tlut, int color_idx, int num_colors) { (void)tlut; (void)color_idx; (void)num_colors; }
+HOST_INLINE int rdpq_sprite_upload(rdpq_tile_t tile, sprite_t *s, const rdpq_texparms_t *parms) { (void)tile; (void)s; (void)parms; return 0; }
+
+/*********************************
+               Text
+*********************************/
+
+typedef enum { ALIGN_LEFT, ALIGN_CENTER, ALIGN_RIGHT } rdpq_align_t;
+typedef enum { VALIGN_TOP, VALIGN_CENTER, VALIGN_BOTTOM } rdpq_valign_t;
+typedef enum { WRAP_NONE, WRAP_ELLIPSES, WRAP_CHAR, WRAP_WORD } rdpq_textwrap_t;
+typedef enum { FONT_BUILTIN_DEBUG_MONO = 1, FONT_BUILTIN_DEBUG_VAR = 2 } rdpq_font_builtin_t;
+
+typedef struct rdpq_font_s { int dummy; } rdpq_font_t;
+typedef struct { color_t color; color_t outline_color; } rdpq_fontstyle_t;
+
+typedef struct {
+    int16_t style_id;
+    int16_t width;
+    int16_t height;
+    rdpq_align_t align;
+    rdpq_valign_t valign;
+    int16_t indent;
+    int16_t max_chars;
+    int16_t char_spacing;
+    int16_t line_spacing;
+    rdpq_textwrap_t wrap;
+    int16_t *tabstops;
+    bool disable_aa_fix;
+    bool preserve_overlap;
+} rdpq_textparms_t;
+
+typedef struct { float advance_x; float advance_y; int utf8_text_advance; } rdpq_textmetrics_t;
+
+typedef struct { struct { float x0, y0, x1, y1; } bbox; int nlines; int nchars; int capacity; float x0; float y0; } rdpq_paragraph_t;
+
+HOST_INLINE rdpq_font_t *rdpq_font_load(const char *fn) { (void)fn; return (rdpq_font_t*)calloc(1, sizeof(rdpq_font_t)); }
+HOST_INLINE rdpq_font_t *rdpq_font_load_builtin(rdpq_font_builtin_t b) { (void)b; return (rdpq_font_t*)calloc(1, sizeof(rdpq_font_t)); }
+HOST_INLINE void rdpq_font_free(rdpq_font_t *f) { free(f); }
+HOST_INLINE void rdpq_font_style(rdpq_font_t *f, uint8_t style_id, const rdpq_fontstyle_t *style) { (void)f; (void)style_id; (void)style; }
+HOST_INLINE void rdpq_text_register_font(uint8_t id, const rdpq_font_t *f) { (void)id; (void)f; }
+HOST_INLINE void rdpq_text_unregister_font(uint8_t id) { (void)id; }
+HOST_INLINE rdpq_textmetrics_t rdpq_text_print(const rdpq_textparms_t *parms, uint8_t font_id, float x0, float y0, const char *utf8_text) { (void)parms; (void)font_id; (void)x0; (void)y0; (void)utf8_text; rdpq_textmetrics_t m = {0, 0, 0}; return m; }
+HOST_INLINE rdpq_textmetrics_t rdpq_text_printf(const rdpq_textparms_t *parms, uint8_t font_id, float x0, float y0, const char *fmt, ...) { (void)parms; (void)font_id; (void)x0; (void)y0; (void)fmt; rdpq_textmetrics_t m = {0, 0, 0}; return m; }
+HOST_INLINE rdpq_paragraph_t *rdpq_paragraph_build(const rdpq_textparms_t *parms, uint8_t initial_font_id, const char *utf8_text, int *nbytes) { (void)parms; (void)initial_font_id; (void)utf8_text; (void)nbytes; return (rdpq_paragraph_t*)calloc(1, sizeof(rdpq_paragraph_t)); }
+HOST_INLINE void rdpq_paragraph_render(const rdpq_paragraph_t *layout, float x0, float y0) { (void)layout; (void)x0; (void)y0; }
+HOST_INLINE void rdpq_paragraph_free(rdpq_paragraph_t *layout) { free(layout); }
+
+/*********************************
+              Joypad
+*********************************/
+
+typedef enum { JOYPAD_PORT_1, JOYPAD_PORT_2, JOYPAD_PORT_3, JOYPAD_PORT_4, JOYPAD_PORT_COUNT } joypad_port_t;
+typedef enum { JOYPAD_2D_ANY = 0xFF } joypad_2d_t;
+typedef enum { JOYPAD_8WAY_NONE = -1, JOYPAD_8WAY_RIGHT, JOYPAD_8WAY_UP_RIGHT, JOYPAD_8WAY_UP, JOYPAD_8WAY_UP_LEFT, JOYPAD_8WAY_LEFT, JOYPAD_8WAY_DOWN_LEFT, JOYPAD_8WAY_DOWN, JOYPAD_8WAY_DOWN_RIGHT } joypad_8way_t;
+
+typedef union {
+    uint16_t raw;
+    struct {
+        unsigned a : 1; unsigned b : 1; unsigned z : 1; unsigned start : 1;
+        unsigned d_up : 1; unsigned d_down : 1; unsigned d_left : 1; unsigned d_right : 1;
+        unsigned : 2; unsigned l : 1; unsigned r : 1;
+        unsigned c_up : 1; unsigned c_down : 1; unsigned c_left : 1; unsigned c_right : 1;
+    };
+} joypad_buttons_t;
+
+typedef struct { joypad_buttons_t btn; int8_t stick_x; int8_t stick_y; int8_t cstick_x; int8_t cstick_y; } joypad_inputs_t;
+
+HOST_INLINE void joypad_init(void) {}
+HOST_INLINE void joypad_poll(void) {}
+HOST_INLINE bool joypad_is_connected(joypad_port_t port) { (void)port; return false; }
+HOST_INLINE joypad_buttons_t joypad_get_buttons_pressed(joypad_port_t port) { (void)port; joypad_buttons_t b; b.raw = 0; return b; }
+HOST_INLINE joypad_buttons_t joypad_get_buttons_held(joypad_port_t port) { (void)port; joypad_buttons_t b; b.raw = 0; return b; }
+HOST_INLINE joypad_inputs_t joypad_get_inputs(joypad_port_t port) { (void)port; joypad_inputs_t i; memset(&i, 0, sizeof(i)); return i; }
+HOST_INLINE joypad_8way_t joypad_get_direction(joypad_port_t port, joypad_2d_t axes) { (void)port; (void)axes; return JOYPAD_8WAY_NONE; }
+
+/*********************************
+              Audio
+*********************************/
+
+typedef struct { int dummy; } wav64_t;
+typedef struct { int dummy; } xm64player_t;
+HOST_INLINE void wav64_open(wav64_t *wav, const char *fn) { (void)wav; (void)fn; }
+HOST_INLINE void wav64_play(wav64_t *wav, int ch) { (void)wav; (void)ch; }
+HOST_INLINE void wav64_close(wav64_t *wav) { (void)wav; }
+HOST_INLINE void mixer_ch_set_vol(int ch, float lvol, float rvol) { (void)ch; (void)lvol; (void)rvol; }
+HOST_INLINE void mixer_ch_stop(int ch) { (void)ch; }
+HOST_INLINE void mixer_try_play(void) {}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
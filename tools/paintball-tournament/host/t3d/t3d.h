@@ -0,0 +1,80 @@
+/***************************************************************
+                            t3d.h
+
+Host-side stand-in for the Tiny3D renderer API. Nothing is ever
+drawn, but viewports still produce screen-space positions.
+***************************************************************/
+
+#ifndef HOST_T3D_H
+#define HOST_T3D_H
+
+#include <libdragon.h>
+#include "t3dmath.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct { int matrixStackSize; } T3DInitParams;
+
+typedef struct {
+    T3DFrustum viewFrustum;
+    T3DVec3 camPos;
+    T3DVec3 camTarget;
+    int size[2];
+} T3DViewport;
+
+typedef struct {
+    int16_t posA[3]; uint16_t normA;
+    int16_t posB[3]; uint16_t normB;
+    uint32_t rgbaA; uint32_t rgbaB;
+    int16_t stA[2]; int16_t stB[2];
+} T3DVertPacked;
+
+typedef enum {
+    T3D_FLAG_DEPTH      = 1 << 0,
+    T3D_FLAG_TEXTURED   = 1 << 1,
+    T3D_FLAG_SHADED     = 1 << 2,
+    T3D_FLAG_CULL_FRONT = 1 << 3,
+    T3D_FLAG_CULL_BACK  = 1 << 4,
+    T3D_FLAG_NO_LIGHT   = 1 << 5,
+} T3DDrawFlags;
+
+typedef enum { T3D_VERTEX_FX_NONE, T3D_VERTEX_FX_SPHERICAL_UV, T3D_VERTEX_FX_CELSHADE_COLOR, T3D_VERTEX_FX_CELSHADE_ALPHA, T3D_VERTEX_FX_OUTLINE } T3DVertexFX;
+
+HOST_INLINE void t3d_init(T3DInitParams params) { (void)params; }
+HOST_INLINE void t3d_destroy(void) {}
+HOST_INLINE void t3d_frame_start(void) {}
+HOST_INLINE void t3d_screen_clear_color(color_t c) { (void)c; }
+HOST_INLINE void t3d_screen_clear_depth(void) {}
+HOST_INLINE T3DViewport t3d_viewport_create(void) { T3DViewport v; memset(&v, 0, sizeof(v)); v.size[0] = 320; v.size[1] = 240; return v; }
+HOST_INLINE void t3d_viewport_attach(T3DViewport *vp) { (void)vp; }
+HOST_INLINE void t3d_viewport_set_projection(T3DViewport *vp, float fov, float n, float f) { (void)vp; (void)fov; (void)n; (void)f; }
+HOST_INLINE void t3d_viewport_look_at(T3DViewport *vp, const T3DVec3 *eye, const T3DVec3 *target, const T3DVec3 *up) { (void)up; vp->camPos = *eye; vp->camTarget = *target; }
+HOST_INLINE void t3d_viewport_calc_viewspace_pos(T3DViewport *vp, T3DVec3 *out, const T3DVec3 *pos) {
+    out->v[0] = (float)vp->size[0] / 2.0f + (pos->v[0] - vp->camTarget.v[0]);
+    out->v[1] = (float)vp->size[1] / 2.0f + (pos->v[2] - vp->camTarget.v[2]) - pos->v[1];
+    out->v[2] = 0.5f;
+}
+HOST_INLINE void t3d_light_set_ambient(const uint8_t *color) { (void)color; }
+HOST_INLINE void t3d_light_set_directional(int index, const uint8_t *color, const T3DVec3 *dir) { (void)index; (void)color; (void)dir; }
+HOST_INLINE void t3d_light_set_point(int index, const uint8_t *color, const T3DVec3 *pos, float size, bool ignoreNormals) { (void)index; (void)color; (void)pos; (void)size; (void)ignoreNormals; }
+HOST_INLINE void t3d_light_set_count(int count) { (void)count; }
+HOST_INLINE void t3d_matrix_push(const T3DMat4FP *mat) { (void)mat; }
+HOST_INLINE void t3d_matrix_pop(int count) { (void)count; }
+HOST_INLINE void t3d_matrix_set(const T3DMat4FP *mat, bool multiply) { (void)mat; (void)multiply; }
+HOST_INLINE void t3d_state_set_drawflags(T3DDrawFlags flags) { (void)flags; }
+HOST_INLINE void t3d_state_set_vertex_fx(T3DVertexFX fx, int16_t arg0, int16_t arg1) { (void)fx; (void)arg0; (void)arg1; }
+HOST_INLINE uint16_t t3d_vert_pack_normal(const T3DVec3 *normal) { (void)normal; return 0; }
+HOST_INLINE void t3d_vert_load(const T3DVertPacked *vert, uint32_t offset, uint32_t count) { (void)vert; (void)offset; (void)count; }
+HOST_INLINE void t3d_tri_draw(uint32_t v0, uint32_t v1, uint32_t v2) { (void)v0; (void)v1; (void)v2; }
+HOST_INLINE void t3d_tri_sync(void) {}
+
+#ifdef __cplusplus
+}
+
+inline void t3d_viewport_calc_viewspace_pos(T3DViewport &vp, T3DVec3 &out, const T3DVec3 &pos) { t3d_viewport_calc_viewspace_pos(&vp, &out, &pos); }
+inline void t3d_light_set_point(int index, const uint8_t *color, const T3DVec3 &pos, float size, bool ignoreNormals) { t3d_light_set_point(index, color, &pos, size, ignoreNormals); }
+#endif
+
+#endif
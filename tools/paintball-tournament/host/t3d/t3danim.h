@@ -0,0 +1,45 @@
+/***************************************************************
+                          t3danim.h
+
+Host-side stand-in for Tiny3D animations. Playback time advances
+so gameplay keyed to animation phases still behaves.
+***************************************************************/
+
+#ifndef HOST_T3DANIM_H
+#define HOST_T3DANIM_H
+
+#include "t3dskeleton.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    const T3DChunkAnim *animRef;
+    float time;
+    float speed;
+    bool isPlaying;
+    bool isLooping;
+} T3DAnim;
+
+HOST_INLINE T3DAnim t3d_anim_create(const T3DModel *model, const char *name) { (void)name; T3DAnim a = { &model->anim, 0.0f, 1.0f, true, true }; return a; }
+HOST_INLINE void t3d_anim_destroy(T3DAnim *anim) { (void)anim; }
+HOST_INLINE void t3d_anim_attach(T3DAnim *anim, const T3DSkeleton *skel) { (void)anim; (void)skel; }
+HOST_INLINE void t3d_anim_set_playing(T3DAnim *anim, bool playing) { anim->isPlaying = playing; }
+HOST_INLINE void t3d_anim_set_looping(T3DAnim *anim, bool loop) { anim->isLooping = loop; }
+HOST_INLINE void t3d_anim_set_speed(T3DAnim *anim, float speed) { anim->speed = speed; }
+HOST_INLINE void t3d_anim_set_time(T3DAnim *anim, float time) { anim->time = time; }
+HOST_INLINE void t3d_anim_update(T3DAnim *anim, float deltaTime) {
+    if (!anim->isPlaying) return;
+    anim->time += deltaTime * anim->speed;
+    if (anim->time >= anim->animRef->duration) {
+        if (anim->isLooping) anim->time = fmodf(anim->time, anim->animRef->duration);
+        else { anim->time = anim->animRef->duration; anim->isPlaying = false; }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,12 @@
+/***************************************************************
+                          t3ddebug.h
+
+Host-side stand-in for the Tiny3D debug helpers.
+***************************************************************/
+
+#ifndef HOST_T3DDEBUG_H
+#define HOST_T3DDEBUG_H
+
+#include "t3d.h"
+
+#endif
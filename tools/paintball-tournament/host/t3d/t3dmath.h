@@ -0,0 +1,61 @@
+/***************************************************************
+                          t3dmath.h
+
+Host-side stand-in for the Tiny3D math helpers. Vector math is
+implemented for real since simulation code depends on it.
+***************************************************************/
+
+#ifndef HOST_T3DMATH_H
+#define HOST_T3DMATH_H
+
+#include <libdragon.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define T3D_PI 3.14159265358979f
+#define T3D_DEG_TO_RAD(deg) ((deg) * (T3D_PI / 180.0f))
+
+typedef struct { float v[3]; } T3DVec3;
+typedef struct { float v[4]; } T3DVec4;
+typedef struct { float m[4][4]; } T3DMat4;
+typedef struct { int32_t m[4][4]; } T3DMat4FP;
+typedef struct { T3DVec4 planes[6]; } T3DFrustum;
+
+HOST_INLINE float t3d_lerp(float a, float b, float t) { return a + (b - a) * t; }
+HOST_INLINE float t3d_lerp_angle(float a, float b, float t) {
+    float diff = fmodf(b - a, 2.0f * T3D_PI);
+    float dist = fmodf(2.0f * diff, 2.0f * T3D_PI) - diff;
+    return a + dist * t;
+}
+
+HOST_INLINE void t3d_vec3_add(T3DVec3 *res, const T3DVec3 *a, const T3DVec3 *b) { for (int i = 0; i < 3; i++) res->v[i] = a->v[i] + b->v[i]; }
+HOST_INLINE void t3d_vec3_diff(T3DVec3 *res, const T3DVec3 *a, const T3DVec3 *b) { for (int i = 0; i < 3; i++) res->v[i] = a->v[i] - b->v[i]; }
+HOST_INLINE void t3d_vec3_scale(T3DVec3 *res, const T3DVec3 *a, float s) { for (int i = 0; i < 3; i++) res->v[i] = a->v[i] * s; }
+HOST_INLINE float t3d_vec3_dot(const T3DVec3 *a, const T3DVec3 *b) { return a->v[0]*b->v[0] + a->v[1]*b->v[1] + a->v[2]*b->v[2]; }
+HOST_INLINE float t3d_vec3_len2(const T3DVec3 *a) { return t3d_vec3_dot(a, a); }
+HOST_INLINE float t3d_vec3_len(const T3DVec3 *a) { return sqrtf(t3d_vec3_len2(a)); }
+HOST_INLINE void t3d_vec3_norm(T3DVec3 *res) { float len = t3d_vec3_len(res); if (len < 0.0001f) len = 0.0001f; t3d_vec3_scale(res, res, 1.0f / len); }
+HOST_INLINE void t3d_vec3_lerp(T3DVec3 *res, const T3DVec3 *a, const T3DVec3 *b, float t) { for (int i = 0; i < 3; i++) res->v[i] = t3d_lerp(a->v[i], b->v[i], t); }
+
+HOST_INLINE void t3d_mat4fp_from_srt_euler(T3DMat4FP *mat, const float scale[3], const float rot[3], const float translate[3]) { (void)mat; (void)scale; (void)rot; (void)translate; }
+HOST_INLINE bool t3d_frustum_vs_aabb_s16(const T3DFrustum *frustum, const int16_t min[3], const int16_t max[3]) { (void)frustum; (void)min; (void)max; return true; }
+HOST_INLINE bool t3d_frustum_vs_aabb(const T3DFrustum *frustum, const T3DVec3 *min, const T3DVec3 *max) { (void)frustum; (void)min; (void)max; return true; }
+
+#ifdef __cplusplus
+}
+
+inline void t3d_vec3_add(T3DVec3 &res, const T3DVec3 &a, const T3DVec3 &b) { t3d_vec3_add(&res, &a, &b); }
+inline void t3d_vec3_diff(T3DVec3 &res, const T3DVec3 &a, const T3DVec3 &b) { t3d_vec3_diff(&res, &a, &b); }
+inline void t3d_vec3_scale(T3DVec3 &res, const T3DVec3 &a, float s) { t3d_vec3_scale(&res, &a, s); }
+inline float t3d_vec3_dot(const T3DVec3 &a, const T3DVec3 &b) { return t3d_vec3_dot(&a, &b); }
+inline float t3d_vec3_len2(const T3DVec3 &a) { return t3d_vec3_len2(&a); }
+inline float t3d_vec3_len(const T3DVec3 &a) { return t3d_vec3_len(&a); }
+inline void t3d_vec3_norm(T3DVec3 &res) { t3d_vec3_norm(&res); }
+inline void t3d_vec3_lerp(T3DVec3 &res, const T3DVec3 &a, const T3DVec3 &b, float t) { t3d_vec3_lerp(&res, &a, &b, t); }
+inline void t3d_mat4fp_from_srt_euler(T3DMat4FP *mat, const float (&scale)[3], const float (&rot)[3], const float (&translate)[3]) { t3d_mat4fp_from_srt_euler(mat, &scale[0], &rot[0], &translate[0]); }
+inline void t3d_mat4fp_from_srt_euler(T3DMat4FP *mat, const T3DVec3 &scale, const T3DVec3 &rot, const T3DVec3 &translate) { t3d_mat4fp_from_srt_euler(mat, &scale.v[0], &rot.v[0], &translate.v[0]); }
+#endif
+
+#endif
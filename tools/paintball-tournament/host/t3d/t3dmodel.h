@@ -0,0 +1,38 @@
+/***************************************************************
+                          t3dmodel.h
+
+Host-side stand-in for Tiny3D model loading. Models are empty
+placeholders so constructors that record display lists succeed.
+***************************************************************/
+
+#ifndef HOST_T3DMODEL_H
+#define HOST_T3DMODEL_H
+
+#include "t3d.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum { T3D_CHUNK_TYPE_OBJECT, T3D_CHUNK_TYPE_MATERIAL, T3D_CHUNK_TYPE_SKELETON, T3D_CHUNK_TYPE_ANIM } T3DModelChunkType;
+
+typedef struct { int dummy; } T3DMaterial;
+typedef struct { T3DMaterial *material; } T3DObject;
+typedef struct { uint32_t boneCount; } T3DChunkSkeleton;
+typedef struct { float duration; } T3DChunkAnim;
+typedef struct { T3DChunkSkeleton skeleton; T3DChunkAnim anim; } T3DModel;
+typedef struct { T3DObject *object; int index; } T3DModelIter;
+
+HOST_INLINE T3DModel *t3d_model_load(const char *path) { (void)path; T3DModel *m = (T3DModel*)calloc(1, sizeof(T3DModel)); m->skeleton.boneCount = 1; m->anim.duration = 1.0f; return m; }
+HOST_INLINE void t3d_model_free(T3DModel *model) { free(model); }
+HOST_INLINE void t3d_model_draw(const T3DModel *model) { (void)model; }
+HOST_INLINE T3DModelIter t3d_model_iter_create(const T3DModel *model, T3DModelChunkType type) { (void)model; (void)type; T3DModelIter it = { NULL, 0 }; return it; }
+HOST_INLINE bool t3d_model_iter_next(T3DModelIter *iter) { (void)iter; return false; }
+HOST_INLINE void t3d_model_draw_material(T3DMaterial *mat, T3DMaterial *prev) { (void)mat; (void)prev; }
+HOST_INLINE void t3d_model_draw_object(const T3DObject *obj, const T3DMat4FP *boneMatrices) { (void)obj; (void)boneMatrices; }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,46 @@
+/***************************************************************
+                        t3dskeleton.h
+
+Host-side stand-in for Tiny3D skeletons.
+***************************************************************/
+
+#ifndef HOST_T3DSKELETON_H
+#define HOST_T3DSKELETON_H
+
+#include "t3dmodel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct { T3DVec3 position; float rotation[4]; T3DVec3 scale; } T3DBone;
+typedef struct {
+    T3DBone *bones;
+    T3DMat4FP *boneMatricesFP;
+    const T3DChunkSkeleton *skeletonRef;
+} T3DSkeleton;
+
+HOST_INLINE T3DSkeleton t3d_skeleton_create(const T3DModel *model) {
+    T3DSkeleton s;
+    s.skeletonRef = &model->skeleton;
+    s.bones = (T3DBone*)calloc(model->skeleton.boneCount, sizeof(T3DBone));
+    s.boneMatricesFP = (T3DMat4FP*)malloc_uncached(model->skeleton.boneCount * sizeof(T3DMat4FP));
+    return s;
+}
+HOST_INLINE T3DSkeleton t3d_skeleton_clone(const T3DSkeleton *skel, bool useMatrices) {
+    T3DSkeleton s;
+    s.skeletonRef = skel->skeletonRef;
+    s.bones = (T3DBone*)calloc(skel->skeletonRef->boneCount, sizeof(T3DBone));
+    s.boneMatricesFP = useMatrices ? (T3DMat4FP*)malloc_uncached(skel->skeletonRef->boneCount * sizeof(T3DMat4FP)) : NULL;
+    return s;
+}
+HOST_INLINE void t3d_skeleton_destroy(T3DSkeleton *skel) { free(skel->bones); if (skel->boneMatricesFP) free_uncached(skel->boneMatricesFP); skel->bones = NULL; skel->boneMatricesFP = NULL; }
+HOST_INLINE void t3d_skeleton_update(const T3DSkeleton *skel) { (void)skel; }
+HOST_INLINE void t3d_skeleton_blend(const T3DSkeleton *res, const T3DSkeleton *a, const T3DSkeleton *b, float factor) { (void)res; (void)a; (void)b; (void)factor; }
+HOST_INLINE void t3d_model_draw_skinned(const T3DModel *model, const T3DSkeleton *skel) { (void)model; (void)skel; }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
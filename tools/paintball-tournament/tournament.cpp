@@ -0,0 +1,229 @@
+/***************************************************************
+                        tournament.cpp
+
+Runs headless all-AI paintball matches on the host and reports
+how a "challenger" AI parameter set in player 1's slot does
+against the default AI in the remaining slots. The real game
+sources are compiled against the stubs in host/, so the results
+reflect the exact AI and gameplay code that ships in the ROM.
+***************************************************************/
+
+#include <libdragon.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../core.h"
+#include "../../code/paintball/src/game.hpp"
+
+namespace {
+    // Same fixed tick the ROM runs at
+    constexpr float TickRate = 30.f;
+    constexpr float DeltaTime = 1.f / TickRate;
+
+    // A match that hasn't finished in this many ticks is counted as a timeout
+    constexpr uint64_t MaxTicksPerMatch = (uint64_t)(TickRate * 60.f * 30.f);
+
+    struct Config {
+        AiDiff difficulty;
+        AIParams challenger;
+    };
+
+    struct Result {
+        int matches;
+        int timeouts;
+        int wins[PlayerCount];
+        int rounds;
+        float roundLength;
+        int captures;
+        uint64_t ticks;
+    };
+
+    struct Options {
+        int matches = 100;
+        int threads = 0;
+        uint32_t seed = 1;
+        std::vector<float> difficulties {DIFF_EASY, DIFF_MEDIUM, DIFF_HARD};
+        std::vector<float> temperatures {AITemperature};
+        std::vector<float> unstables {AIUnstable};
+        std::vector<float> actionRates {AIActionRateSecond};
+    };
+
+    std::vector<float> parseList(const char *arg)
+    {
+        std::vector<float> values;
+        std::string list(arg);
+        size_t start = 0;
+        while (start <= list.size()) {
+            size_t end = list.find(',', start);
+            if (end == std::string::npos) end = list.size();
+            values.push_back(std::strtof(list.substr(start, end - start).c_str(), nullptr));
+            start = end + 1;
+        }
+        return values;
+    }
+
+    void usage(const char *name)
+    {
+        fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  -m N      matches per configuration (default 100)\n"
+            "  -j N      worker threads (default: hardware concurrency)\n"
+            "  -s N      base seed (default 1)\n"
+            "  -d LIST   AI difficulties to sweep, 0-2 (default 0,1,2)\n"
+            "  -t LIST   challenger temperatures to sweep\n"
+            "  -u LIST   challenger unstable values to sweep\n"
+            "  -r LIST   challenger action rates in seconds to sweep\n",
+            name
+        );
+    }
+
+    // Seeds only depend on the configuration and match index, never on the worker
+    uint32_t matchSeed(uint32_t base, uint32_t config, uint32_t match)
+    {
+        uint32_t h = base * 0x9E3779B1u ^ config * 0x85EBCA77u ^ match * 0xC2B2AE3Du;
+        h ^= h >> 16;
+        h *= 0x7FEB352Du;
+        h ^= h >> 15;
+        return h;
+    }
+
+    void playMatch(const Config &config, uint32_t seed, Result &result)
+    {
+        core_set_playercount(0);
+        core_set_aidifficulty(config.difficulty);
+        core_rng_seed(seed);
+
+        AIParamSet params = DefaultAIParamSet;
+        params[PLAYER_1] = config.challenger;
+
+        Game game(params);
+        for (int step = 0; !game.warmup(step); step++);
+
+        uint64_t ticks = 0;
+        while (game.getState().state != STATE_FINISHED && ticks < MaxTicksPerMatch) {
+            game.fixedUpdate(DeltaTime);
+            ticks++;
+        }
+
+        const GameState &state = game.getState();
+        result.matches++;
+        result.ticks += ticks;
+        if (state.state != STATE_FINISHED) {
+            result.timeouts++;
+            return;
+        }
+
+        result.wins[state.winner]++;
+        for (int i = 0; i < RoundCount; i++) {
+            result.rounds++;
+            result.roundLength += state.rounds[i].length;
+            result.captures += state.rounds[i].captures;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        const char *value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (!strcmp(argv[i], "-h") || !value) {
+            usage(argv[0]);
+            return strcmp(argv[i], "-h") ? 1 : 0;
+        }
+
+        if (!strcmp(argv[i], "-m")) options.matches = atoi(value);
+        else if (!strcmp(argv[i], "-j")) options.threads = atoi(value);
+        else if (!strcmp(argv[i], "-s")) options.seed = (uint32_t)strtoul(value, nullptr, 0);
+        else if (!strcmp(argv[i], "-d")) options.difficulties = parseList(value);
+        else if (!strcmp(argv[i], "-t")) options.temperatures = parseList(value);
+        else if (!strcmp(argv[i], "-u")) options.unstables = parseList(value);
+        else if (!strcmp(argv[i], "-r")) options.actionRates = parseList(value);
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+
+    if (options.threads <= 0) {
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::vector<Config> configs;
+    for (float difficulty : options.difficulties) {
+        for (float temperature : options.temperatures) {
+            for (float unstable : options.unstables) {
+                for (float actionRate : options.actionRates) {
+                    AIParams params = DefaultAIParams;
+                    params.temperature = temperature;
+                    params.unstable = unstable;
+                    params.actionRateSecond = actionRate;
+                    configs.push_back(Config {(AiDiff)(int)difficulty, params});
+                }
+            }
+        }
+    }
+
+    // Every worker keeps its own results per config and they are merged at the end, so
+    // there's no contention besides picking the next job
+    const size_t jobCount = configs.size() * options.matches;
+    std::atomic<size_t> nextJob {0};
+    std::vector<std::vector<Result>> workerResults(options.threads, std::vector<Result>(configs.size()));
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (int w = 0; w < options.threads; w++) {
+        workers.emplace_back([&, w]() {
+            size_t job;
+            while ((job = nextJob.fetch_add(1)) < jobCount) {
+                size_t config = job / options.matches;
+                size_t match = job % options.matches;
+                playMatch(configs[config], matchSeed(options.seed, config, match), workerResults[w][config]);
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("diff  temp   unstable  rate   | P1 win  P2 win  P3 win  P4 win  | round len  captures/round  timeouts\n");
+
+    uint64_t totalTicks = 0;
+    for (size_t c = 0; c < configs.size(); c++) {
+        Result total {};
+        for (auto &results : workerResults) {
+            const Result &r = results[c];
+            total.matches += r.matches;
+            total.timeouts += r.timeouts;
+            for (int i = 0; i < PlayerCount; i++) total.wins[i] += r.wins[i];
+            total.rounds += r.rounds;
+            total.roundLength += r.roundLength;
+            total.captures += r.captures;
+            total.ticks += r.ticks;
+        }
+        totalTicks += total.ticks;
+
+        const Config &config = configs[c];
+        const int finished = std::max(1, total.matches - total.timeouts);
+        const int rounds = std::max(1, total.rounds);
+        printf("%-4d  %-5.3f  %-8.3f  %-5.2f  |", config.difficulty, config.challenger.temperature, config.challenger.unstable, config.challenger.actionRateSecond);
+        for (int i = 0; i < PlayerCount; i++) {
+            printf(" %5.1f%% ", 100.f * total.wins[i] / finished);
+        }
+        printf(" | %8.2fs  %14.2f  %8d\n", total.roundLength / rounds, (float)total.captures / rounds, total.timeouts);
+    }
+
+    printf("\n%zu matches on %d threads in %.2fs, %.0f ticks/sec\n", jobCount, options.threads, seconds, totalTicks / seconds);
+    return 0;
+}
@@ -0,0 +1,174 @@
+/***************************************************************
+                         hullbench.c
+
+Times polyquiz's quickhull against the gift wrapping it replaced
+over a range of point counts, and checks that every hull it
+builds is closed and convex, and that the edge adjacency built
+from it is consistent. Points are spread on a sphere like
+the game does, so every point is a hull vertex and a correct
+hull of N points has exactly 2N-4 faces.
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+
+#include "hull.h"
+
+#define MAX_FACES 200
+
+static Face faces[MAX_FACES];
+static int num_faces;
+
+static Edge edges[MAX_FACES * 3 / 2];
+static int neighbors[MAX_FACES][3];
+
+/*********************************
+       Reference gift wrapping
+*********************************/
+
+static Vertex subtract(Vertex v1, Vertex v2) {
+    return (Vertex){ v1.x - v2.x, v1.y - v2.y, v1.z - v2.z };
+}
+
+static Vertex cross_product(Vertex v1, Vertex v2) {
+    return (Vertex){ v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x };
+}
+
+static float dot_product(Vertex v1, Vertex v2) {
+    return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+}
+
+static int is_convex(Vertex p, Vertex q, Vertex r, Vertex s) {
+    Vertex n = cross_product(subtract(q, p), subtract(r, p));
+    return dot_product(n, subtract(s, p)) >= 0;
+}
+
+// The O(n^4) hull polyquiz used to build, kept verbatim apart from its inputs
+static void gift_wrapping(const Vertex *vertices, int num_vertices) {
+    num_faces = 0;
+
+    int start = 0;
+    for (int i = 1; i < num_vertices; i++) {
+        if (vertices[i].x < vertices[start].x) {
+            start = i;
+        }
+    }
+
+    int p = start;
+    do {
+        for (int i = 0; i < num_vertices; i++) {
+            for (int j = i + 1; j < num_vertices; j++) {
+                if (i != p && j != p) {
+                    int found = 1;
+                    for (int k = 0; k < num_vertices; k++) {
+                        if (k != p && k != i && k != j && !is_convex(vertices[p], vertices[i], vertices[j], vertices[k])) {
+                            found = 0;
+                            break;
+                        }
+                    }
+                    if (found && num_faces < MAX_FACES) {
+                        faces[num_faces].v1 = p;
+                        faces[num_faces].v2 = i;
+                        faces[num_faces].v3 = j;
+                        num_faces++;
+                    }
+                }
+            }
+        }
+        p++;
+        if (p == num_vertices) {
+            p = 0;
+        }
+    } while (p != start && num_faces < MAX_FACES);
+}
+
+/*********************************
+            Benchmark
+*********************************/
+
+static void random_points(Vertex *points, int count) {
+    for (int i = 0; i < count; i++) {
+        float theta = (rand() / (float)RAND_MAX) * 2.0f * 3.1415628f;
+        float phi = acosf(1.0f - 2.0f * (rand() / (float)RAND_MAX));
+        points[i] = (Vertex){ sinf(phi) * cosf(theta), sinf(phi) * sinf(theta), cosf(phi) };
+    }
+}
+
+// Every point must be on the inner side of every face, and every edge must be
+// shared by exactly two faces going in opposite directions
+static bool check_hull(const Vertex *points, int count) {
+    for (int f = 0; f < num_faces; f++) {
+        Vertex a = points[faces[f].v1], b = points[faces[f].v2], c = points[faces[f].v3];
+        Vertex n = cross_product(subtract(b, a), subtract(c, a));
+        for (int i = 0; i < count; i++) {
+            if (dot_product(n, subtract(points[i], a)) < -1e-4f) return false;
+        }
+
+        int v[3] = { faces[f].v1, faces[f].v2, faces[f].v3 };
+        for (int e = 0; e < 3; e++) {
+            int twins = 0;
+            for (int g = 0; g < num_faces; g++) {
+                int w[3] = { faces[g].v1, faces[g].v2, faces[g].v3 };
+                for (int k = 0; k < 3; k++) {
+                    if (w[k] == v[(e+1)%3] && w[(k+1)%3] == v[e]) twins++;
+                }
+            }
+            if (twins != 1) return false;
+        }
+    }
+
+    // The adjacency has to agree, and all points are hull vertices
+    int num_edges = hull_adjacency(faces, num_faces, edges, neighbors);
+    if (num_edges < 0 || count - num_edges + num_faces != 2) return false;
+    for (int i = 0; i < num_edges; i++) {
+        const Edge *e = &edges[i];
+        bool found = false;
+        for (int k = 0; k < 3; k++) found |= neighbors[e->f1][k] == e->f2;
+        if (!found) return false;
+    }
+    return true;
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv) {
+    int runs = argc > 1 ? atoi(argv[1]) : 20;
+    const int counts[] = { 5, 10, 14, 20, 30, 50, 75, 100 };
+
+    srand(1);
+    printf("points | gift wrap us  faces | quickhull us  faces  valid\n");
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        int count = counts[c];
+        Vertex points[HULL_MAX_POINTS];
+        double wrapTime = 0, hullTime = 0;
+        int wrapFaces = 0, hullFaces = 0, valid = 0;
+
+        for (int r = 0; r < runs; r++) {
+            random_points(points, count);
+
+            double t = now();
+            gift_wrapping(points, count);
+            wrapTime += now() - t;
+            wrapFaces += num_faces;
+
+            t = now();
+            num_faces = quickhull(points, count, faces, MAX_FACES);
+            hullTime += now() - t;
+            hullFaces += num_faces;
+
+            if (num_faces == 2 * count - 4 && check_hull(points, count)) valid++;
+        }
+
+        printf("%6d | %12.1f  %5.1f | %12.1f  %5.1f  %d/%d\n", count,
+            wrapTime * 1e6 / runs, (float)wrapFaces / runs,
+            hullTime * 1e6 / runs, (float)hullFaces / runs, valid, runs);
+    }
+    return 0;
+}
@@ -0,0 +1,332 @@
+#include "hull.h"
+#include <math.h>
+#include <float.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+// Working faces are recycled through a free list, so the live hull plus the
+// cone added for a new point always fits in twice the point budget.
+#define HULL_MAX_WORK_FACES (2 * HULL_MAX_POINTS)
+
+typedef struct {
+    int v[3];           // Counter-clockwise seen from outside
+    int adj[3];         // Face across the edge v[e] -> v[(e+1)%3]
+    Vertex n;           // Outward plane normal, a point p is outside if n.p > d
+    float d;
+    int outside;        // Head of the list of points outside of this face
+    int visit;          // Last visibility pass that reached this face
+    bool alive;
+} HullFace;
+
+typedef struct {
+    const Vertex *points;
+    float eps;
+
+    HullFace faces[HULL_MAX_WORK_FACES];
+    int free_faces[HULL_MAX_WORK_FACES];
+    int num_free;
+
+    int next_point[HULL_MAX_POINTS];   // Outside lists, chained by point index
+    int visit;
+
+    // Scratch space for adding a point
+    int visible[HULL_MAX_WORK_FACES];
+    int horizon[HULL_MAX_WORK_FACES][3];     // Edge start, end, and the face behind it
+    int cone[HULL_MAX_WORK_FACES];
+    int cone_by_start[HULL_MAX_POINTS];
+} Hull;
+
+static Vertex vsub(Vertex a, Vertex b) {
+    return (Vertex){ a.x - b.x, a.y - b.y, a.z - b.z };
+}
+
+static Vertex vcross(Vertex a, Vertex b) {
+    return (Vertex){ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+static float vdot(Vertex a, Vertex b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+static float face_distance(Hull *h, int f, int p) {
+    return vdot(h->faces[f].n, h->points[p]) - h->faces[f].d;
+}
+
+static int face_new(Hull *h, int a, int b, int c) {
+    if (h->num_free == 0) return -1;
+    int f = h->free_faces[--h->num_free];
+
+    HullFace *face = &h->faces[f];
+    face->v[0] = a; face->v[1] = b; face->v[2] = c;
+    face->adj[0] = face->adj[1] = face->adj[2] = -1;
+    face->outside = -1;
+    face->visit = 0;
+    face->alive = true;
+
+    Vertex n = vcross(vsub(h->points[b], h->points[a]), vsub(h->points[c], h->points[a]));
+    float len = sqrtf(vdot(n, n));
+    if (len > 0) {
+        n.x /= len; n.y /= len; n.z /= len;
+    }
+    face->n = n;
+    face->d = vdot(n, h->points[a]);
+    return f;
+}
+
+static void face_free(Hull *h, int f) {
+    h->faces[f].alive = false;
+    h->free_faces[h->num_free++] = f;
+}
+
+// Index of the edge a -> b in face f
+static int face_edge(Hull *h, int f, int a, int b) {
+    for (int e = 0; e < 3; e++) {
+        if (h->faces[f].v[e] == a && h->faces[f].v[(e+1)%3] == b) return e;
+    }
+    return -1;
+}
+
+// Adds point p to the outside list of the first face in the list it's in front of.
+// Returns false if the point is inside all of them.
+static bool assign_point(Hull *h, int p, const int *candidates, int num_candidates) {
+    for (int i = 0; i < num_candidates; i++) {
+        int f = candidates[i];
+        if (face_distance(h, f, p) > h->eps) {
+            h->next_point[p] = h->faces[f].outside;
+            h->faces[f].outside = p;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool initial_simplex(Hull *h, int num_points, int *simplex) {
+    const Vertex *pts = h->points;
+
+    // The two points furthest apart along an axis
+    int a = 0, b = 0;
+    for (int i = 1; i < num_points; i++) {
+        if (pts[i].x < pts[a].x) a = i;
+        if (pts[i].x > pts[b].x) b = i;
+    }
+
+    // The point furthest from the line ab
+    Vertex ab = vsub(pts[b], pts[a]);
+    int c = -1;
+    float best = h->eps * h->eps;
+    for (int i = 0; i < num_points; i++) {
+        Vertex cr = vcross(ab, vsub(pts[i], pts[a]));
+        float dist = vdot(cr, cr);
+        if (dist > best) { best = dist; c = i; }
+    }
+    if (c < 0) return false;
+
+    // The point furthest from the plane abc
+    Vertex n = vcross(ab, vsub(pts[c], pts[a]));
+    float nlen = sqrtf(vdot(n, n));
+    int d = -1;
+    best = h->eps;
+    for (int i = 0; i < num_points; i++) {
+        float dist = fabsf(vdot(n, vsub(pts[i], pts[a]))) / nlen;
+        if (dist > best) { best = dist; d = i; }
+    }
+    if (d < 0) return false;
+
+    // Wind the base so that d ends up behind it
+    if (vdot(n, vsub(pts[d], pts[a])) > 0) {
+        int t = b; b = c; c = t;
+    }
+
+    int verts[4][3] = { {a, b, c}, {a, d, b}, {b, d, c}, {c, d, a} };
+    for (int i = 0; i < 4; i++) {
+        simplex[i] = face_new(h, verts[i][0], verts[i][1], verts[i][2]);
+    }
+
+    // Every edge of the tetrahedron is shared by exactly two of its faces
+    for (int i = 0; i < 4; i++) {
+        for (int e = 0; e < 3; e++) {
+            HullFace *face = &h->faces[simplex[i]];
+            for (int j = 0; j < 4; j++) {
+                if (j != i && face_edge(h, simplex[j], face->v[(e+1)%3], face->v[e]) >= 0) {
+                    face->adj[e] = simplex[j];
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < num_points; i++) {
+        if (i != a && i != b && i != c && i != d)
+            assign_point(h, i, simplex, 4);
+    }
+    return true;
+}
+
+// Adds the outside point of face f that is furthest from it to the hull.
+// Returns false if the hull ran out of faces.
+static bool add_point(Hull *h, int f) {
+    HullFace *face = &h->faces[f];
+
+    // The furthest point is certainly on the hull
+    int eye = face->outside;
+    float best = face_distance(h, f, eye);
+    for (int p = h->next_point[eye]; p >= 0; p = h->next_point[p]) {
+        float dist = face_distance(h, f, p);
+        if (dist > best) { best = dist; eye = p; }
+    }
+
+    // Flood fill all faces the eye can see, the edges where that stops form the horizon
+    h->visit++;
+    int num_visible = 0, num_horizon = 0;
+    h->visible[num_visible++] = f;
+    face->visit = h->visit;
+    for (int i = 0; i < num_visible; i++) {
+        HullFace *vf = &h->faces[h->visible[i]];
+        for (int e = 0; e < 3; e++) {
+            int nf = vf->adj[e];
+            if (h->faces[nf].visit == h->visit) continue;
+            if (face_distance(h, nf, eye) > h->eps) {
+                h->faces[nf].visit = h->visit;
+                h->visible[num_visible++] = nf;
+            } else {
+                h->horizon[num_horizon][0] = vf->v[e];
+                h->horizon[num_horizon][1] = vf->v[(e+1)%3];
+                h->horizon[num_horizon][2] = nf;
+                num_horizon++;
+            }
+        }
+    }
+
+    // Orphan the points of the visible faces and retire them
+    int orphans = -1;
+    for (int i = 0; i < num_visible; i++) {
+        int p = h->faces[h->visible[i]].outside;
+        while (p >= 0) {
+            int next = h->next_point[p];
+            if (p != eye) {
+                h->next_point[p] = orphans;
+                orphans = p;
+            }
+            p = next;
+        }
+        face_free(h, h->visible[i]);
+    }
+
+    // Connect every horizon edge to the eye
+    for (int i = 0; i < num_horizon; i++) {
+        int a = h->horizon[i][0], b = h->horizon[i][1], behind = h->horizon[i][2];
+        int nf = face_new(h, a, b, eye);
+        if (nf < 0) return false;
+        h->cone[i] = nf;
+        h->cone_by_start[a] = nf;
+
+        h->faces[nf].adj[0] = behind;
+        h->faces[behind].adj[face_edge(h, behind, b, a)] = nf;
+    }
+
+    // The horizon is a single loop, so the cone face starting at b is the neighbour across b -> eye
+    for (int i = 0; i < num_horizon; i++) {
+        HullFace *cf = &h->faces[h->cone[i]];
+        int next = h->cone_by_start[cf->v[1]];
+        cf->adj[1] = next;
+        h->faces[next].adj[2] = h->cone[i];
+    }
+
+    // Points that aren't outside the cone are inside the hull for good
+    while (orphans >= 0) {
+        int next = h->next_point[orphans];
+        assign_point(h, orphans, h->cone, num_horizon);
+        orphans = next;
+    }
+    return true;
+}
+
+int quickhull(const Vertex *points, int num_points, Face *faces, int max_faces) {
+    static Hull h;
+
+    if (num_points < 4 || num_points > HULL_MAX_POINTS) return -1;
+
+    h.points = points;
+    h.visit = 0;
+    h.num_free = 0;
+    for (int i = HULL_MAX_WORK_FACES - 1; i >= 0; i--) {
+        h.faces[i].alive = false;
+        h.free_faces[h.num_free++] = i;
+    }
+
+    // Tolerance relative to the size of the cloud, so the result doesn't depend on its scale
+    float extent = 0;
+    for (int i = 0; i < num_points; i++) {
+        extent = fmaxf(extent, fabsf(points[i].x) + fabsf(points[i].y) + fabsf(points[i].z));
+    }
+    h.eps = extent * 64 * FLT_EPSILON;
+
+    int simplex[4];
+    if (!initial_simplex(&h, num_points, simplex)) return -1;
+
+    // New faces can reuse slots that were already swept, so keep going until no face
+    // has outside points left
+    bool added;
+    do {
+        added = false;
+        for (int f = 0; f < HULL_MAX_WORK_FACES; f++) {
+            if (!h.faces[f].alive || h.faces[f].outside < 0) continue;
+            if (!add_point(&h, f)) return -1;
+            added = true;
+        }
+    } while (added);
+
+    int num_faces = 0;
+    for (int f = 0; f < HULL_MAX_WORK_FACES; f++) {
+        HullFace *face = &h.faces[f];
+        if (!face->alive) continue;
+        if (num_faces == max_faces) return -1;
+
+        faces[num_faces].v1 = face->v[0];
+        faces[num_faces].v2 = face->v[2];
+        faces[num_faces].v3 = face->v[1];
+        faces[num_faces].color_idx = 0;
+        num_faces++;
+    }
+    return num_faces;
+}
+
+typedef struct {
+    int v1, v2;     // v1 < v2
+    int face;
+    int edge;       // Index of the edge within the face
+} HalfEdge;
+
+static int half_edge_compare(const void *a, const void *b) {
+    const HalfEdge *ea = a, *eb = b;
+    if (ea->v1 != eb->v1) return ea->v1 - eb->v1;
+    return ea->v2 - eb->v2;
+}
+
+int hull_adjacency(const Face *faces, int num_faces, Edge *edges, int (*neighbors)[3]) {
+    static HalfEdge half_edges[HULL_MAX_WORK_FACES * 3];
+
+    if (num_faces > HULL_MAX_WORK_FACES) return -1;
+
+    int num_half_edges = 0;
+    for (int f = 0; f < num_faces; f++) {
+        int v[3] = { faces[f].v1, faces[f].v2, faces[f].v3 };
+        for (int e = 0; e < 3; e++) {
+            int a = v[e], b = v[(e+1)%3];
+            half_edges[num_half_edges++] = (HalfEdge){ a < b ? a : b, a < b ? b : a, f, e };
+        }
+    }
+    qsort(half_edges, num_half_edges, sizeof(HalfEdge), half_edge_compare);
+
+    // On a closed mesh every edge shows up exactly twice in a row
+    int num_edges = 0;
+    for (int i = 0; i < num_half_edges; i += 2) {
+        HalfEdge *a = &half_edges[i], *b = &half_edges[i+1];
+        if (i + 1 >= num_half_edges || half_edge_compare(a, b) != 0) return -1;
+        if (i + 2 < num_half_edges && half_edge_compare(b, &half_edges[i+2]) == 0) return -1;
+
+        edges[num_edges++] = (Edge){ a->v1, a->v2, a->face, b->face };
+        neighbors[a->face][a->edge] = b->face;
+        neighbors[b->face][b->edge] = a->face;
+    }
+    return num_edges;
+}
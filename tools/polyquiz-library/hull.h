@@ -0,0 +1,40 @@
+#ifndef POLYQUIZ_HULL_H
+#define POLYQUIZ_HULL_H
+
+// Upper bound on the points quickhull accepts. A hull of N points
+// has at most 2N-4 triangles.
+#define HULL_MAX_POINTS 128
+
+typedef struct {
+    float x, y, z;
+} Vertex;
+
+typedef struct {
+    int v1, v2, v3;
+    int color_idx;
+} Face;
+
+typedef struct {
+    int v1, v2;     // v1 < v2
+    int f1, f2;     // The two faces sharing the edge
+} Edge;
+
+// Computes the convex hull of a point cloud with the incremental 3D
+// quickhull algorithm, in O(n log n) on average. Faces are wound so the
+// hull lies on the positive side of (v2-v1) x (v3-v1), like the gift
+// wrapping it replaces did. Points inside the hull or on one of its faces
+// aren't referenced by any face.
+// Returns the number of faces, or -1 if the points are degenerate (fewer
+// than 4, or all on a plane) or the hull doesn't fit in max_faces.
+int quickhull(const Vertex *points, int num_points, Face *faces, int max_faces);
+
+// Finds every edge of a closed triangle mesh and the faces on both sides of
+// it, by sorting the face edges so that the two copies of each one end up
+// next to each other. neighbors[f][e] is set to the face across the edge
+// starting at vertex e of face f (v1 -> v2, v2 -> v3, v3 -> v1).
+// edges must have room for num_faces * 3 / 2 entries.
+// Returns the number of edges, or -1 if an edge isn't shared by exactly two
+// faces.
+int hull_adjacency(const Face *faces, int num_faces, Edge *edges, int (*neighbors)[3]);
+
+#endif
@@ -0,0 +1,259 @@
+/***************************************************************
+                         mkpolylib.c
+
+Generates the library of polyhedra polyquiz picks from, in the
+format described in code/polyquiz/polylib.h. Points are spread
+on a sphere, so every point ends up a hull vertex and a shape
+built from N points has exactly 2N-4 faces. That lets the
+library hold the same number of shapes for every face count in
+the requested range. Each shape is stored ready to draw:
+colored, with face normals and packed vertices.
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include "hull.h"
+#include "polylib.h"
+
+#define MAX_FACES (2 * HULL_MAX_POINTS - 4)
+#define MAX_EDGES (MAX_FACES * 3 / 2)
+
+typedef struct {
+    uint8_t *data;
+    size_t size, capacity;
+} Buffer;
+
+static uint32_t rng_state;
+
+/*********************************
+             Helpers
+*********************************/
+
+// splitmix32, the library only has to be reproducible from its seed
+static uint32_t rng_next(void) {
+    uint32_t z = (rng_state += 0x9E3779B9u);
+    z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+    return z ^ (z >> 16);
+}
+
+static float rng_float(void) {
+    return (rng_next() >> 8) * (1.0f / 16777216.0f);
+}
+
+static void put(Buffer *buf, const void *data, size_t size) {
+    if (buf->size + size > buf->capacity) {
+        buf->capacity = (buf->size + size) * 2;
+        buf->data = realloc(buf->data, buf->capacity);
+    }
+    memcpy(buf->data + buf->size, data, size);
+    buf->size += size;
+}
+
+static void put_u8(Buffer *buf, uint8_t v) {
+    put(buf, &v, 1);
+}
+
+static void put_u16(Buffer *buf, uint16_t v) {
+    uint8_t b[2] = { v >> 8, v };
+    put(buf, b, 2);
+}
+
+static void put_u32(Buffer *buf, uint32_t v) {
+    uint8_t b[4] = { v >> 24, v >> 16, v >> 8, v };
+    put(buf, b, 4);
+}
+
+static void put_f32(Buffer *buf, float f) {
+    uint32_t v;
+    memcpy(&v, &f, 4);
+    put_u32(buf, v);
+}
+
+/*********************************
+            Generation
+*********************************/
+
+static Vertex random_vertex(void) {
+    float theta = rng_float() * 2.0f * 3.1415628f;
+    float phi = acosf(1.0f - 2.0f * rng_float());
+    return (Vertex){ sinf(phi) * cosf(theta), sinf(phi) * sinf(theta), cosf(phi) };
+}
+
+// Same greedy coloring the game used to run: a random starting color per face,
+// skipping the ones its three neighbors already have
+static void color_faces(Face *faces, int num_faces, int (*neighbors)[3]) {
+    for (int i = 0; i < num_faces; i++)
+        faces[i].color_idx = -1;
+
+    for (int i = 0; i < num_faces; i++) {
+        int idx = rng_next() % PALETTE_SIZE;
+        for (int c = 0; c < (int)PALETTE_SIZE; c++) {
+            int color = (idx+c) % PALETTE_SIZE;
+            if (faces[neighbors[i][0]].color_idx != color &&
+                faces[neighbors[i][1]].color_idx != color &&
+                faces[neighbors[i][2]].color_idx != color) {
+                faces[i].color_idx = color;
+                break;
+            }
+        }
+    }
+}
+
+static void write_entry(Buffer *buf, int target_faces) {
+    static Vertex points[HULL_MAX_POINTS];
+    static Face faces[MAX_FACES];
+    static Edge edges[MAX_EDGES];
+    static int neighbors[MAX_FACES][3];
+
+    int num_points = (target_faces + 4) / 2;
+    int num_faces, num_edges;
+
+    // Nearly coplanar points can merge faces, just try again with a new set
+    do {
+        for (int i = 0; i < num_points; i++)
+            points[i] = random_vertex();
+        num_faces = quickhull(points, num_points, faces, MAX_FACES);
+        num_edges = num_faces == target_faces ? hull_adjacency(faces, num_faces, edges, neighbors) : -1;
+    } while (num_edges < 0 || num_points - num_edges + num_faces != 2);
+
+    color_faces(faces, num_faces, neighbors);
+
+    put_u16(buf, num_points);
+    put_u16(buf, num_faces);
+    put_u16(buf, num_edges);
+    put_u16(buf, 0);
+
+    for (int i = 0; i < num_points; i++) {
+        put_f32(buf, points[i].x);
+        put_f32(buf, points[i].y);
+        put_f32(buf, points[i].z);
+    }
+
+    for (int i = 0; i < num_edges; i++) {
+        put_u8(buf, edges[i].v1);
+        put_u8(buf, edges[i].v2);
+    }
+    for (uint32_t i = num_edges * 2; i < polylib_edges_size(num_edges); i++)
+        put_u8(buf, 0);
+
+    for (int i = 0; i < num_faces; i++) {
+        Vertex v[3] = { points[faces[i].v1], points[faces[i].v2], points[faces[i].v3] };
+
+        Vertex normal;
+        normal.x = (v[1].y - v[0].y) * (v[2].z - v[0].z) - (v[1].z - v[0].z) * (v[2].y - v[0].y);
+        normal.y = (v[1].z - v[0].z) * (v[2].x - v[0].x) - (v[1].x - v[0].x) * (v[2].z - v[0].z);
+        normal.z = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[1].y - v[0].y) * (v[2].x - v[0].x);
+
+        // Unit length, so it fits in a byte per component
+        float scale = 127.0f / sqrtf(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+        Color color = palette[faces[i].color_idx];
+
+        for (int j = 0; j < 3; j++) {
+            put_f32(buf, v[j].x);
+            put_f32(buf, v[j].y);
+            put_f32(buf, v[j].z);
+            put_u8(buf, (int8_t)lroundf(normal.x * scale));
+            put_u8(buf, (int8_t)lroundf(normal.y * scale));
+            put_u8(buf, (int8_t)lroundf(normal.z * scale));
+            put_u8(buf, 0);
+            put_u8(buf, color.r * 255);
+            put_u8(buf, color.g * 255);
+            put_u8(buf, color.b * 255);
+            put_u8(buf, 0.8f * 255);
+        }
+    }
+}
+
+static void usage(const char *name) {
+    fprintf(stderr,
+        "Usage: %s [options] -o FILE\n"
+        "  -f MIN-MAX  range of face counts, even numbers from 4 (default 6-24)\n"
+        "  -n N        polyhedra per face count (default 32)\n"
+        "  -s N        seed (default 1)\n",
+        name
+    );
+}
+
+int main(int argc, char **argv) {
+    const char *output = NULL;
+    int min_faces = 6, max_faces = 24, per_count = 32;
+    uint32_t seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (!value) {
+            usage(argv[0]);
+            return 1;
+        }
+
+        if (!strcmp(argv[i], "-o")) output = value;
+        else if (!strcmp(argv[i], "-f")) {
+            if (sscanf(value, "%d-%d", &min_faces, &max_faces) != 2) {
+                usage(argv[0]);
+                return 1;
+            }
+        }
+        else if (!strcmp(argv[i], "-n")) per_count = atoi(value);
+        else if (!strcmp(argv[i], "-s")) seed = strtoul(value, NULL, 0);
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+
+    if (!output) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (min_faces < 4 || max_faces > MAX_FACES || min_faces > max_faces || min_faces % 2 || max_faces % 2) {
+        fprintf(stderr, "Face counts must be even and between 4 and %d\n", MAX_FACES);
+        return 1;
+    }
+
+    rng_state = seed;
+
+    int count = ((max_faces - min_faces) / 2 + 1) * per_count;
+    if (count > 0xFFFF) {
+        fprintf(stderr, "Too many polyhedra\n");
+        return 1;
+    }
+
+    // Entries are built first, so the offset table can be written in front of them
+    Buffer entries = {0};
+    uint32_t *offsets = malloc((count + 1) * sizeof(uint32_t));
+    uint32_t base = sizeof(PolyLibHeader) + (count + 1) * sizeof(uint32_t);
+    int index = 0;
+    for (int faces = min_faces; faces <= max_faces; faces += 2) {
+        for (int i = 0; i < per_count; i++) {
+            offsets[index++] = base + entries.size;
+            write_entry(&entries, faces);
+        }
+    }
+    offsets[count] = base + entries.size;
+
+    Buffer file = {0};
+    put_u32(&file, POLYLIB_MAGIC);
+    put_u16(&file, POLYLIB_VERSION);
+    put_u16(&file, count);
+    for (int i = 0; i <= count; i++)
+        put_u32(&file, offsets[i]);
+    put(&file, entries.data, entries.size);
+
+    FILE *f = fopen(output, "wb");
+    if (!f || fwrite(file.data, 1, file.size, f) != file.size) {
+        fprintf(stderr, "Cannot write %s\n", output);
+        return 1;
+    }
+    fclose(f);
+
+    free(offsets);
+    free(entries.data);
+    free(file.data);
+    return 0;
+}
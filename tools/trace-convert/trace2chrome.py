@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""
+Converts the trace the ROM dumps with TRACE_CAPTURE to Chrome trace JSON,
+which chrome://tracing and https://ui.perfetto.dev can open.
+
+When a minigame ends, core_trace_dump writes its timeline to the debug log:
+
+    [trace] begin snake3d 46875000
+    [trace] 0012d687 F 1 -
+    [trace] 0012d690 B 1 fixedloop
+    ...
+    [trace] end
+
+Each event line is the timer tick in hex, the event type, the frame number
+and a name ("-" if none). The types are:
+
+    B/E  CPU zone begin/end      K  rspq block submitted
+    F/S  frame begin/submitted   R  RDP done with the frame
+    V    vertical blank
+
+Every dump in the log becomes its own process in the output, named after
+the minigame. The RDP track shows each frame as busy from the moment its
+work could start (its begin, or the previous frame's RDP completion if that
+came later) until the RDP reported it done, so the gaps are RDP idle time.
+
+    python3 trace2chrome.py usb.log -o trace.json
+"""
+
+import argparse
+import json
+import re
+import sys
+
+BEGIN = re.compile(r"\[trace\] begin (\S+) (\d+)")
+EVENT = re.compile(r"\[trace\] ([0-9a-fA-F]{8}) ([A-Z]) (\d+) (.*)")
+END = "[trace] end"
+
+TID_CPU, TID_RSPQ, TID_RDP, TID_DISPLAY = 1, 2, 3, 4
+THREAD_NAMES = {TID_CPU: "CPU", TID_RSPQ: "rspq blocks", TID_RDP: "RDP", TID_DISPLAY: "Display"}
+
+
+def read_dumps(lines):
+    dumps, current = [], None
+    for line in lines:
+        line = line.rstrip("\r\n")
+        match = BEGIN.search(line)
+        if match:
+            current = {"game": match.group(1), "tps": int(match.group(2)), "events": []}
+            continue
+        if current is None:
+            continue
+        if END in line:
+            dumps.append(current)
+            current = None
+            continue
+        match = EVENT.search(line)
+        if match:
+            current["events"].append(
+                (int(match.group(1), 16), match.group(2), int(match.group(3)), match.group(4).strip())
+            )
+    return dumps
+
+
+def convert(dump, pid):
+    out = [
+        {"ph": "M", "pid": pid, "name": "process_name", "args": {"name": dump["game"]}},
+    ]
+    for tid, name in THREAD_NAMES.items():
+        out.append({"ph": "M", "pid": pid, "tid": tid, "name": "thread_name", "args": {"name": name}})
+
+    # The timer is 32 bits, so unwrap it. Events are stored in the order they happened.
+    base, last, wraps = None, 0, 0
+    frame_begin, rdp_free = {}, None
+    for ticks, kind, frame, name in dump["events"]:
+        if base is None:
+            base, last = ticks, ticks
+        if ticks < last and last - ticks > 0x80000000:
+            wraps += 1
+        last = ticks
+        us = ((ticks + (wraps << 32)) - base) * 1000000 / dump["tps"]
+
+        if kind == "B":
+            out.append({"ph": "B", "pid": pid, "tid": TID_CPU, "ts": us, "name": name})
+        elif kind == "E":
+            out.append({"ph": "E", "pid": pid, "tid": TID_CPU, "ts": us})
+        elif kind == "K":
+            out.append({"ph": "i", "s": "t", "pid": pid, "tid": TID_RSPQ, "ts": us, "name": name,
+                        "args": {"frame": frame}})
+        elif kind == "F":
+            frame_begin[frame] = us
+        elif kind == "S":
+            out.append({"ph": "i", "s": "t", "pid": pid, "tid": TID_DISPLAY, "ts": us, "name": "frame submitted",
+                        "args": {"frame": frame}})
+        elif kind == "V":
+            out.append({"ph": "i", "s": "t", "pid": pid, "tid": TID_DISPLAY, "ts": us, "name": "vblank"})
+        elif kind == "R":
+            start = frame_begin.get(frame)
+            if start is not None:
+                if rdp_free is not None and rdp_free > start:
+                    start = rdp_free
+                out.append({"ph": "X", "pid": pid, "tid": TID_RDP, "ts": start, "dur": us - start,
+                            "name": f"frame {frame}"})
+            rdp_free = us
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert TRACE_CAPTURE dumps to Chrome trace JSON")
+    parser.add_argument("log", nargs="?", help="debug log, stdin if left out")
+    parser.add_argument("-o", "--output", help="output file, stdout if left out")
+    args = parser.parse_args()
+
+    if args.log:
+        with open(args.log, errors="replace") as f:
+            dumps = read_dumps(f)
+    else:
+        dumps = read_dumps(sys.stdin)
+    if not dumps:
+        print("No complete [trace] dumps found", file=sys.stderr)
+        return 1
+
+    events = []
+    for pid, dump in enumerate(dumps, 1):
+        events.extend(convert(dump, pid))
+    trace = json.dumps({"traceEvents": events, "displayTimeUnit": "ms"})
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(trace)
+    else:
+        print(trace)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+Aggregates the menu to minigame transition timings the ROM logs.
+
+Every time a minigame shows its first frame, core_transition_report
+prints a line like:
+
+    [transition] snake3d menu=1234 load=5678 init=91011 warmup=1415 frame=1213 total=100551
+
+with each phase in microseconds. Capture the debug log of a few runs
+(the emulator's console, or the USB log) and pass the files here, or
+pipe the log in. Lines that aren't transition reports are ignored.
+
+    python3 transition_stats.py run1.log run2.log
+    python3 transition_stats.py --csv < run.log > transitions.csv
+"""
+
+import argparse
+import re
+import statistics
+import sys
+from collections import OrderedDict, defaultdict
+
+PHASES = ["menu", "load", "init", "warmup", "frame", "total"]
+LINE = re.compile(r"\[transition\]\s+(\S+)((?:\s+\w+=\d+)+)")
+
+
+def parse(lines):
+    runs = defaultdict(list)
+    for line in lines:
+        match = LINE.search(line)
+        if not match:
+            continue
+        fields = dict(f.split("=") for f in match.group(2).split())
+        runs[match.group(1)].append({k: int(v) for k, v in fields.items()})
+    return runs
+
+
+def read_inputs(paths):
+    if not paths:
+        return parse(sys.stdin)
+    lines = []
+    for path in paths:
+        with open(path, errors="replace") as f:
+            lines.extend(f)
+    return parse(lines)
+
+
+def summarize(samples):
+    return OrderedDict(
+        (
+            ("min", min(samples)),
+            ("median", statistics.median(samples)),
+            ("mean", statistics.fmean(samples)),
+            ("max", max(samples)),
+        )
+    )
+
+
+def print_table(runs):
+    for game in sorted(runs):
+        print(f"{game} ({len(runs[game])} runs), milliseconds")
+        print(f"  {'phase':<6} {'min':>9} {'median':>9} {'mean':>9} {'max':>9}")
+        for phase in PHASES:
+            samples = [r[phase] / 1000 for r in runs[game] if phase in r]
+            if not samples:
+                continue
+            s = summarize(samples)
+            print(f"  {phase:<6} {s['min']:9.2f} {s['median']:9.2f} {s['mean']:9.2f} {s['max']:9.2f}")
+        print()
+
+
+def print_csv(runs):
+    print(",".join(["game", "run"] + PHASES))
+    for game in sorted(runs):
+        for i, run in enumerate(runs[game]):
+            print(",".join([game, str(i)] + [str(run.get(p, "")) for p in PHASES]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Aggregate minigame transition timings from debug logs")
+    parser.add_argument("logs", nargs="*", help="log files, stdin if none")
+    parser.add_argument("--csv", action="store_true", help="print every run as CSV instead of a summary")
+    args = parser.parse_args()
+
+    runs = read_inputs(args.logs)
+    if not runs:
+        print("No [transition] lines found", file=sys.stderr)
+        return 1
+
+    if args.csv:
+        print_csv(runs)
+    else:
+        print_table(runs)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())